@@ -0,0 +1,219 @@
+/**
+ * @file pipeline.cpp
+ * @brief Arena-Backed DSP Pipeline Runner - Implementation
+ *
+ * @author DSP Team (Implementation Agent)
+ * @date 2026-08-26
+ * @target STM32H562 (Cortex-M33, 250 MHz)
+ *
+ * CONFIDENTIAL - Binary-only delivery
+ */
+
+#include "pipeline.h"
+#include <string.h>
+
+/* ============================================================================
+ * PLATFORM MACROS
+ * ============================================================================ */
+
+/** Prevent compiler reordering across plan-bank publishes */
+#define PIPELINE_COMPILER_BARRIER()  __asm volatile("" ::: "memory")
+
+/* ============================================================================
+ * STATE
+ * ============================================================================ */
+
+/** Registered stage table */
+typedef struct {
+    PipelineStageFn fn;         /**< Stage entry point */
+    uint32_t flags;             /**< PIPELINE_STAGE_* flags */
+    bool enabled;               /**< Planned into the chain */
+} PipelineStage;
+
+static PipelineStage s_stages[PIPELINE_MAX_STAGES];
+static int s_stage_count = 0;
+
+/**
+ * Intermediate buffer arena: two block-sized slots. With in-place
+ * reuse the planner needs at most ping/pong intermediates for any
+ * chain length, and keeping both slots contiguous means the whole
+ * inter-stage working set is 2 * PIPELINE_MAX_BLOCK_SIZE floats -
+ * one pair of cache lines per slot at the 32-sample block size.
+ */
+static float s_arena[2][PIPELINE_MAX_BLOCK_SIZE];
+
+/**
+ * Planned chain step. NULL src stands for the caller's input buffer,
+ * NULL dst for the caller's output buffer - both are only known at
+ * Pipeline_ProcessBlock() time.
+ */
+typedef struct {
+    PipelineStageFn fn;         /**< Stage entry point */
+    float* src;                 /**< Source buffer (NULL = caller input) */
+    float* dst;                 /**< Destination buffer (NULL = caller output) */
+} PipelinePlanStep;
+
+/** One execution plan bank */
+typedef struct {
+    PipelinePlanStep steps[PIPELINE_MAX_STAGES];
+    int count;                  /**< Enabled stages planned */
+    uint32_t arena_used;        /**< Arena bytes carved */
+} PipelinePlan;
+
+/** Double-banked plans: the ISR reads s_plans[s_plan_active] */
+static PipelinePlan s_plans[2];
+static volatile uint8_t s_plan_active = 0;
+
+/* ============================================================================
+ * PRIVATE FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Build the execution plan into the inactive bank and publish it
+ *
+ * Walks the enabled stages tracking the buffer the block lives in.
+ * The final stage always writes the caller's output; an interior
+ * in-place-capable stage keeps the block where it is (once it has left
+ * the caller's read-only input); everything else ping-pongs between
+ * the two arena slots.
+ */
+static void Pipeline_Replan(void)
+{
+    PipelinePlan* plan = &s_plans[s_plan_active ^ 1u];
+    plan->count = 0;
+
+    int last_enabled = -1;
+    for (int i = 0; i < s_stage_count; i++)
+    {
+        if (s_stages[i].enabled)
+        {
+            last_enabled = i;
+        }
+    }
+
+    float* cur = NULL;          /* NULL = caller input */
+    bool slot_used[2] = { false, false };
+
+    for (int i = 0; i < s_stage_count; i++)
+    {
+        if (!s_stages[i].enabled)
+        {
+            continue;
+        }
+
+        float* dst;
+        if (i == last_enabled)
+        {
+            dst = NULL;         /* caller output */
+        }
+        else if ((s_stages[i].flags & PIPELINE_STAGE_IN_PLACE) != 0 &&
+                 cur != NULL)
+        {
+            dst = cur;          /* run on the buffer it reads */
+        }
+        else
+        {
+            /* Ping-pong: any arena slot the block is not currently in */
+            const int slot = (cur == s_arena[0]) ? 1 : 0;
+            dst = s_arena[slot];
+            slot_used[slot] = true;
+        }
+
+        PipelinePlanStep* step = &plan->steps[plan->count++];
+        step->fn = s_stages[i].fn;
+        step->src = cur;
+        step->dst = dst;
+        cur = dst;
+    }
+
+    plan->arena_used = ((slot_used[0] ? 1u : 0u) + (slot_used[1] ? 1u : 0u))
+                     * PIPELINE_MAX_BLOCK_SIZE * sizeof(float);
+
+    PIPELINE_COMPILER_BARRIER();
+    s_plan_active ^= 1u;
+}
+
+/* ============================================================================
+ * PUBLIC API
+ * ============================================================================ */
+
+void Pipeline_Init(void)
+{
+    s_stage_count = 0;
+    Pipeline_Replan();
+}
+
+int Pipeline_AddStage(PipelineStageFn fn, uint32_t flags)
+{
+    if (fn == NULL || s_stage_count >= PIPELINE_MAX_STAGES)
+    {
+        return -1;
+    }
+
+    const int index = s_stage_count;
+    s_stages[index].fn = fn;
+    s_stages[index].flags = flags;
+    s_stages[index].enabled = true;
+    s_stage_count = index + 1;
+
+    Pipeline_Replan();
+    return index;
+}
+
+bool Pipeline_SetStageEnabled(int stage, bool enabled)
+{
+    if (stage < 0 || stage >= s_stage_count)
+    {
+        return false;
+    }
+
+    s_stages[stage].enabled = enabled;
+    Pipeline_Replan();
+    return true;
+}
+
+void Pipeline_ProcessBlock(float* input, float* output, int numSamples)
+{
+    const PipelinePlan* plan = &s_plans[s_plan_active];
+
+    if (plan->count == 0)
+    {
+        if (output != input)
+        {
+            memcpy(output, input, (size_t)numSamples * sizeof(float));
+        }
+        return;
+    }
+
+    /* Larger caller blocks run through the whole chain one arena slot
+     * at a time, so the inter-stage working set never outgrows it */
+    int offset = 0;
+    while (offset < numSamples)
+    {
+        int chunk = numSamples - offset;
+        if (chunk > PIPELINE_MAX_BLOCK_SIZE)
+        {
+            chunk = PIPELINE_MAX_BLOCK_SIZE;
+        }
+
+        for (int i = 0; i < plan->count; i++)
+        {
+            const PipelinePlanStep* step = &plan->steps[i];
+            float* src = (step->src != NULL) ? step->src : input + offset;
+            float* dst = (step->dst != NULL) ? step->dst : output + offset;
+            step->fn(src, dst, chunk);
+        }
+
+        offset += chunk;
+    }
+}
+
+int Pipeline_GetStageCount(void)
+{
+    return s_stage_count;
+}
+
+uint32_t Pipeline_GetArenaUsed(void)
+{
+    return s_plans[s_plan_active].arena_used;
+}
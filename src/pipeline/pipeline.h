@@ -0,0 +1,138 @@
+/**
+ * @file pipeline.h
+ * @brief Arena-Backed DSP Pipeline Runner
+ *
+ * Runs a registered chain of block-processing stages in one fused loop.
+ * Replaces the hand-rolled QuickTune -> EQ10 -> (BassGuard, soft-clip,
+ * gain) chaining where every stage call owned its own scattered
+ * intermediate buffer: all intermediates come from one contiguous
+ * static arena (two block-sized slots, carved at registration time),
+ * stages that permit in-place processing run on the buffer they read,
+ * and the whole chain executes back-to-back on a block that stays hot
+ * in cache. Chain overhead - everything except the stages' own math -
+ * is one indirect call and two pointer loads per stage per block.
+ *
+ * Stages use the platform ProcessBlock signature:
+ *     void ProcessBlock(float* input, float* output, int numSamples)
+ *
+ * Concurrency follows the EQ10 coefficient publish pattern: the
+ * execution plan is double-banked, registration and enable changes
+ * build the inactive bank in the control context and swap an index the
+ * audio ISR reads once per block. Registration calls must not race
+ * each other.
+ *
+ * @author DSP Team (Implementation Agent)
+ * @date 2026-08-26
+ * @target STM32H562 (Cortex-M33, 250 MHz)
+ *
+ * CONFIDENTIAL - Binary-only delivery
+ */
+
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ============================================================================
+ * CONFIGURATION
+ * ============================================================================ */
+
+/** Maximum registered stages */
+#ifndef PIPELINE_MAX_STAGES
+#define PIPELINE_MAX_STAGES         8
+#endif
+
+/**
+ * Arena slot size in samples - the largest block the chain is fed.
+ * The arena is two slots: with in-place reuse a chain never needs more
+ * than ping/pong intermediates regardless of length, and larger caller
+ * blocks are run through the chain one slot at a time so the working
+ * set stays inside the D-cache.
+ */
+#ifndef PIPELINE_MAX_BLOCK_SIZE
+#define PIPELINE_MAX_BLOCK_SIZE     32
+#endif
+
+/* ============================================================================
+ * STAGE FLAGS
+ * ============================================================================ */
+
+/**
+ * Stage tolerates output == input. The planner then runs the stage on
+ * the buffer it reads instead of carving a second arena slot (EQ10
+ * supports this, see eq10.h). Stages without this flag always get
+ * distinct source and destination buffers.
+ */
+#define PIPELINE_STAGE_IN_PLACE     (1u << 0)
+
+/* ============================================================================
+ * TYPES
+ * ============================================================================ */
+
+/** Stage entry point - the platform ProcessBlock signature */
+typedef void (*PipelineStageFn)(float* input, float* output, int numSamples);
+
+/* ============================================================================
+ * PUBLIC API
+ * ============================================================================ */
+
+/**
+ * @brief Reset the pipeline: no stages, empty plan (pass-through)
+ */
+void Pipeline_Init(void);
+
+/**
+ * @brief Register a stage at the end of the chain
+ *
+ * Rebuilds the execution plan and publishes it before returning, so
+ * the audio ISR picks up the extended chain on its next block.
+ * Stages register enabled.
+ *
+ * @param fn Stage entry point
+ * @param flags PIPELINE_STAGE_* flags
+ * @return Stage index (0-based), or -1 if the stage table is full
+ */
+int Pipeline_AddStage(PipelineStageFn fn, uint32_t flags);
+
+/**
+ * @brief Enable or disable a registered stage
+ *
+ * A disabled stage is planned around, not skipped at run time: the
+ * surrounding stages are rewired so the block never traverses it.
+ *
+ * @param stage Stage index from Pipeline_AddStage()
+ * @param enabled New state
+ * @return false if the index is out of range
+ */
+bool Pipeline_SetStageEnabled(int stage, bool enabled);
+
+/**
+ * @brief Run the chain on one block (audio ISR)
+ *
+ * Executes every enabled stage back-to-back. The caller's input buffer
+ * is never written and the caller's output buffer is only written by
+ * the final stage, so DMA-owned buffers are safe on both ends. With no
+ * enabled stages the input is copied through. Blocks larger than
+ * PIPELINE_MAX_BLOCK_SIZE are processed in slot-sized chunks.
+ *
+ * @param input Input buffer
+ * @param output Output buffer (may equal input only if some stage runs)
+ * @param numSamples Number of samples
+ */
+void Pipeline_ProcessBlock(float* input, float* output, int numSamples);
+
+/**
+ * @brief Number of registered stages (enabled or not)
+ */
+int Pipeline_GetStageCount(void);
+
+/**
+ * @brief Arena bytes carved by the current plan
+ *
+ * 0 for a single-stage or empty chain, one slot when every interior
+ * stage is in-place capable, two slots otherwise.
+ */
+uint32_t Pipeline_GetArenaUsed(void);
+
+#endif /* PIPELINE_H */
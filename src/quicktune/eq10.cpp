@@ -14,6 +14,7 @@
 
 #include "eq10.h"
 #include "quicktune_config.h"
+#include "quicktune_tables.h"
 #include "arm_math.h"  // CMSIS-DSP
 #include <math.h>
 #include <string.h>
@@ -22,18 +23,172 @@
  * PRIVATE STATE
  * ============================================================================ */
 
-/** CMSIS-DSP biquad cascade instance */
-static arm_biquad_casd_df1_inst_f32 s_eq10_instance;
+/**
+ * Compiler barrier: keeps the compiler from reordering coefficient
+ * writes past the publish store. No hardware barrier is needed - the
+ * audio ISR and control task run on the same single Cortex-M33 core,
+ * which observes its own stores in program order.
+ */
+#define EQ10_COMPILER_BARRIER()     __asm volatile("" ::: "memory")
+
+/*
+ * Backend selection (see EQ10_BACKEND in quicktune_config.h).
+ * Both CMSIS cascades consume the same normalized [b0, b1, b2, a1, a2]
+ * coefficient layout; only the instance type, state size and kernel differ.
+ */
+#if EQ10_BACKEND == EQ10_BACKEND_DF2T
+typedef arm_biquad_cascade_df2T_instance_f32 eq10_biquad_inst_t;
+#define EQ10_BIQUAD_INIT            arm_biquad_cascade_df2T_init_f32
+#define EQ10_BIQUAD_PROCESS         arm_biquad_cascade_df2T_f32
+#else
+typedef arm_biquad_casd_df1_inst_f32 eq10_biquad_inst_t;
+#define EQ10_BIQUAD_INIT            arm_biquad_cascade_df1_init_f32
+#define EQ10_BIQUAD_PROCESS         arm_biquad_cascade_df1_f32
+#endif
+
+/** CMSIS-DSP biquad cascade instances, one per channel */
+static eq10_biquad_inst_t s_eq10_instances[EQ10_MAX_CHANNELS];
+
+/**
+ * Double-buffered biquad coefficients: 5 per band × 10 bands per bank,
+ * shared by all channels.
+ *
+ * The control task writes a full coefficient set into the shadow bank
+ * and publishes it with a single atomic index store; the audio path
+ * adopts the published bank at the next block boundary. Filter redesign
+ * can therefore run at any time with no locking and no torn reads in
+ * the audio ISR.
+ */
+QUICKTUNE_FAST_DATA static float s_eq10_coeff_banks[2][EQ10_TOTAL_COEFFS];
+
+/** Bank index last published by the control side (single 32-bit store) */
+static volatile uint32_t s_eq10_published_bank = 0;
+
+/** Bank index currently adopted by the audio path */
+static volatile uint32_t s_eq10_audio_bank = 0;
+
+/** Shadow bank index between BeginCoeffUpdate() and PublishCoeffs() */
+static uint32_t s_eq10_shadow_bank = 1;
+
+/**
+ * Biquad state: 4 per band × 10 bands per channel.
+ * One contiguous pool so adjacent channels' delay lines share cache lines.
+ */
+QUICKTUNE_FAST_DATA static float s_eq10_state[EQ10_MAX_CHANNELS * EQ10_TOTAL_STATE];
+
+/** Number of channel instances created (instance 0 created by EQ10_Init) */
+static int s_eq10_num_instances = 0;
+
+/* --------------------------------------------------------------------------
+ * Q31 PROCESSING PATH (LOW-POWER MODE)
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Post-shift for the Q31 cascade: coefficients are stored in Q1.30
+ * (value/2) so the |a1| < 2 feedback coefficients of the low bands fit,
+ * and the kernel shifts the output back up by one bit.
+ */
+#define EQ10_Q31_POST_SHIFT         1
+
+/**
+ * Input headroom scale for the Q31 path: 6 dB in, compensated on the
+ * way out, so +12 dB band boosts cannot saturate the Q31 delay lines.
+ */
+#define EQ10_Q31_INPUT_SCALE        0.5f
+
+/** Q31 state words per biquad (CMSIS DF1 layout, independent of the float backend) */
+#define EQ10_Q31_STATE_PER_BAND     4
+
+/** CMSIS-DSP Q31 cascade instances, one per channel */
+static arm_biquad_casd_df1_inst_q31 s_eq10_q31_instances[EQ10_MAX_CHANNELS];
 
-/** Biquad coefficients: 5 per band × 10 bands = 50 floats */
-static float s_eq10_coeffs[EQ10_TOTAL_COEFFS];
+/** Quantized coefficients (Q1.30), derived from the adopted float bank */
+QUICKTUNE_FAST_DATA static q31_t s_eq10_q31_coeffs[EQ10_TOTAL_COEFFS];
 
-/** Biquad state: 2 per band × 10 bands = 20 floats */
-static float s_eq10_state[EQ10_TOTAL_STATE];
+/** Q31 biquad state, one contiguous pool like the float state */
+QUICKTUNE_FAST_DATA static q31_t s_eq10_q31_state[EQ10_MAX_CHANNELS * EQ10_NUM_BANDS * EQ10_Q31_STATE_PER_BAND];
+
+/** Processing mode requested by the control side */
+static volatile EQ10ProcessingMode s_eq10_mode = EQ10_MODE_F32;
+
+/** Processing mode adopted by the audio path (block boundary) */
+static EQ10ProcessingMode s_eq10_audio_mode = EQ10_MODE_F32;
+
+/* --------------------------------------------------------------------------
+ * GAIN RAMP ENGINE (LIVE CORRECTION)
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Ramp request handed from the control side to the audio path: target
+ * gains, shared Q and ramp length in blocks. The flag is stored last
+ * (behind the compiler barrier), so the audio path never sees a
+ * half-written request.
+ */
+static float s_eq10_ramp_req_gains[EQ10_NUM_BANDS];
+static float s_eq10_ramp_req_q = QUICKTUNE_EQ_Q;
+static uint32_t s_eq10_ramp_req_blocks = 1;
+static volatile bool s_eq10_ramp_pending = false;
+
+/** Active ramp (audio-path state; touched only at block boundaries) */
+static bool s_eq10_ramp_active = false;
+static float s_eq10_ramp_start[EQ10_NUM_BANDS];
+static float s_eq10_ramp_target[EQ10_NUM_BANDS];
+static float s_eq10_ramp_q = QUICKTUNE_EQ_Q;
+static uint32_t s_eq10_ramp_total = 1;
+static uint32_t s_eq10_ramp_block = 0;
+static int s_eq10_ramp_band = 0;
+
+/** Exact-target redesigns remaining once the interpolation has clamped */
+static int s_eq10_ramp_final = 0;
+
+/** Completion callback, fired from the audio context when a ramp lands */
+static EQ10RampCompleteCallback s_eq10_ramp_callback = NULL;
+static void* s_eq10_ramp_callback_context = NULL;
+
+/** Gains currently realized in the live coefficient bank (audio side) */
+static float s_eq10_live_gains[EQ10_NUM_BANDS];
+
+/** Gains last requested through the dB-domain setters (control side) */
+static float s_eq10_ctrl_gains[EQ10_NUM_BANDS];
+
+#if EQ10_ENABLE_LIMITER
+/* --------------------------------------------------------------------------
+ * OUTPUT LIMITER STATE
+ * -------------------------------------------------------------------------- */
+
+/** Lookahead delay lines, one per channel */
+QUICKTUNE_FAST_DATA static float
+    s_eq10_lim_delay[EQ10_MAX_CHANNELS][EQ10_LIMITER_LOOKAHEAD_SAMPLES];
+
+/** Delay write index per channel (masked, lookahead is a power of two) */
+static uint32_t s_eq10_lim_idx[EQ10_MAX_CHANNELS];
+
+/** Peak envelope per channel (instant attack, exponential release) */
+static float s_eq10_lim_env[EQ10_MAX_CHANNELS];
+
+/** Smoothed limiter gain per channel */
+static float s_eq10_lim_gain[EQ10_MAX_CHANNELS];
+
+/** Deepest gain applied in the most recent block, for metering */
+static volatile float s_eq10_lim_min_gain[EQ10_MAX_CHANNELS];
+
+/** Per-sample smoothing coefficients, derived once in EQ10_Init() */
+static float s_eq10_lim_attack = 0.0f;
+static float s_eq10_lim_release = 1.0f;
+static float s_eq10_lim_release_step = 0.0f;
+
+/** Stage enable, read by the audio path at each block boundary */
+static volatile bool s_eq10_limiter_enabled = false;
+#endif
 
 /** Initialization flag */
 static bool s_eq10_initialized = false;
 
+#if QUICKTUNE_ENABLE_PROFILING
+/** Cycle counter for EQ10_ProcessBlock (DWT, see quicktune_profile.h) */
+static QTProf_Counter s_eq10_prof;
+#endif
+
 /* ============================================================================
  * PRIVATE FUNCTIONS
  * ============================================================================ */
@@ -75,12 +230,14 @@ static void EQ10_DesignBiquad(float fc, float gain_dB, float Q, float fs, float*
     const float a1 = -2.0f * cos_w0;
     const float a2 = 1.0f - alpha / A;
 
-    // Normalize by a0 (CMSIS-DSP expects normalized coefficients)
-    coeffs[0] = b0 / a0;  // b0
-    coeffs[1] = b1 / a0;  // b1
-    coeffs[2] = b2 / a0;  // b2
-    coeffs[3] = a1 / a0;  // a1 (note: already includes sign)
-    coeffs[4] = a2 / a0;  // a2
+    // Normalize by a0 and negate the feedback coefficients: the CMSIS
+    // cascades compute y = b0*x + b1*x1 + b2*x2 + a1*y1 + a2*y2, so the
+    // stored a1/a2 carry the opposite sign of the RBJ denominator
+    coeffs[0] = b0 / a0;   // b0
+    coeffs[1] = b1 / a0;   // b1
+    coeffs[2] = b2 / a0;   // b2
+    coeffs[3] = -a1 / a0;  // -a1 (CMSIS sign convention)
+    coeffs[4] = -a2 / a0;  // -a2 (CMSIS sign convention)
 }
 
 /**
@@ -94,32 +251,591 @@ static inline bool EQ10_IsValidBand(int band)
     return (band >= 0 && band < EQ10_NUM_BANDS);
 }
 
+/**
+ * @brief Quantize a float coefficient set into the Q31 bank
+ *
+ * Coefficients are stored as value/2 in Q31 (i.e. Q1.30) to cover the
+ * |a1| < 2 feedback range of the low bands; the cascade's post-shift of
+ * EQ10_Q31_POST_SHIFT restores the scaling.
+ *
+ * @param src 50 float coefficients (normalized CMSIS layout)
+ */
+static void EQ10_QuantizeCoeffRange(const float* src, int first, int count)
+{
+    for (int i = first; i < first + count; i++)
+    {
+        float scaled = src[i] * (float)(1u << (31 - EQ10_Q31_POST_SHIFT));
+
+        // Saturate: 2.0 maps exactly to full scale, which overflows by one
+        if (scaled >= 2147483647.0f)
+            scaled = 2147483647.0f;
+        if (scaled <= -2147483648.0f)
+            scaled = -2147483648.0f;
+
+        s_eq10_q31_coeffs[i] = (q31_t)scaled;
+    }
+}
+
+static void EQ10_QuantizeCoeffs(const float* src)
+{
+    EQ10_QuantizeCoeffRange(src, 0, EQ10_TOTAL_COEFFS);
+}
+
+#if EQ10_ENABLE_COEFF_CACHE
+
+/* --------------------------------------------------------------------------
+ * COEFFICIENT CACHE (DIRECT-MAPPED ON BAND x QUANTIZED GAIN)
+ * -------------------------------------------------------------------------- */
+
+/** Gain steps across the +/-12 dB range at EQ10_COEFF_CACHE_STEP_DB */
+#define EQ10_CACHE_STEPS \
+    ((int)((QUICKTUNE_MAX_GAIN_DB - QUICKTUNE_MIN_GAIN_DB) / EQ10_COEFF_CACHE_STEP_DB) + 1)
+
+/** One cached design: the 5 coefficients plus the Q they were designed for */
+typedef struct
+{
+    float coeffs[EQ10_COEFFS_PER_BAND];
+    float Q;
+    bool valid;
+} EQ10_CacheEntry;
+
+/** Direct-mapped cache, indexed [band][gain step] */
+static EQ10_CacheEntry s_eq10_coeff_cache[EQ10_NUM_BANDS][EQ10_CACHE_STEPS];
+
+/**
+ * @brief Map a (clipped) gain to its cache step index
+ */
+static inline int EQ10_CacheStep(float gain_dB)
+{
+    int step = (int)((gain_dB - QUICKTUNE_MIN_GAIN_DB) / EQ10_COEFF_CACHE_STEP_DB + 0.5f);
+    if (step < 0)
+        step = 0;
+    if (step > EQ10_CACHE_STEPS - 1)
+        step = EQ10_CACHE_STEPS - 1;
+    return step;
+}
+
+/**
+ * @brief Quantize a gain to the cache grid (nearest step)
+ */
+static inline float EQ10_CacheQuantizeGain(float gain_dB)
+{
+    return QUICKTUNE_MIN_GAIN_DB + (float)EQ10_CacheStep(gain_dB) * EQ10_COEFF_CACHE_STEP_DB;
+}
+
+#endif /* EQ10_ENABLE_COEFF_CACHE */
+
+/**
+ * @brief Design one band's biquad through the coefficient cache
+ *
+ * With the cache enabled the gain is quantized to the cache grid and a
+ * hit is served as a 20-byte copy; a miss (or a Q change on that entry)
+ * runs the RBJ design once and fills the entry. With the cache compiled
+ * out this is a plain EQ10_DesignBiquad() call.
+ *
+ * @param band Band index (validated by the caller)
+ * @param gain_dB Gain in dB (clipped by the caller)
+ * @param Q Quality factor (clipped by the caller)
+ * @param coeffs Output buffer for 5 coefficients
+ * @return The gain actually realized (quantized when cached)
+ */
+static float EQ10_DesignBiquadCached(int band, float gain_dB, float Q, float* coeffs)
+{
+    #if EQ10_ENABLE_COEFF_CACHE
+    const int step = EQ10_CacheStep(gain_dB);
+    EQ10_CacheEntry* entry = &s_eq10_coeff_cache[band][step];
+
+    if (!entry->valid || entry->Q != Q)
+    {
+        const float quantized = QUICKTUNE_MIN_GAIN_DB + (float)step * EQ10_COEFF_CACHE_STEP_DB;
+        EQ10_DesignBiquad(QUICKTUNE_BAND_FREQUENCIES[band], quantized, Q,
+                          QUICKTUNE_SAMPLE_RATE, entry->coeffs);
+        entry->Q = Q;
+        entry->valid = true;
+    }
+
+    memcpy(coeffs, entry->coeffs, sizeof(entry->coeffs));
+    return QUICKTUNE_MIN_GAIN_DB + (float)step * EQ10_COEFF_CACHE_STEP_DB;
+    #else
+    EQ10_DesignBiquad(QUICKTUNE_BAND_FREQUENCIES[band], gain_dB, Q,
+                      QUICKTUNE_SAMPLE_RATE, coeffs);
+    return gain_dB;
+    #endif
+}
+
+/**
+ * @brief Adopt a pending processing-mode change (audio path)
+ *
+ * Called at block boundaries alongside EQ10_AdoptCoeffs(). With the DF1
+ * float backend the delay-line samples are converted between float and
+ * Q31 (including the 6 dB input headroom scale) so the switch is
+ * sample-continuous; the DF2T state words are not interconvertible with
+ * the DF1 layout, so there the incoming cascade restarts from cleared
+ * delay lines.
+ */
+static inline void EQ10_AdoptMode(void)
+{
+    const EQ10ProcessingMode requested = s_eq10_mode;
+
+    if (requested == s_eq10_audio_mode)
+    {
+        return;
+    }
+
+    if (requested == EQ10_MODE_Q31)
+    {
+        // Coefficients for the adopted bank, quantized on this side so a
+        // concurrent publish cannot tear the Q31 set
+        EQ10_QuantizeCoeffs(s_eq10_coeff_banks[s_eq10_audio_bank]);
+
+        #if EQ10_BACKEND == EQ10_BACKEND_DF1
+        // DF1 -> DF1: same x1/x2/y1/y2 layout, just rescale to Q31
+        for (int i = 0; i < s_eq10_num_instances * EQ10_TOTAL_STATE; i++)
+        {
+            float v = s_eq10_state[i] * EQ10_Q31_INPUT_SCALE * 2147483648.0f;
+            if (v >= 2147483647.0f)  v = 2147483647.0f;
+            if (v <= -2147483648.0f) v = -2147483648.0f;
+            s_eq10_q31_state[i] = (q31_t)v;
+        }
+        #else
+        memset(s_eq10_q31_state, 0, sizeof(s_eq10_q31_state));
+        #endif
+    }
+    else
+    {
+        #if EQ10_BACKEND == EQ10_BACKEND_DF1
+        // DF1 -> DF1: rescale Q31 delay lines back to float
+        for (int i = 0; i < s_eq10_num_instances * EQ10_TOTAL_STATE; i++)
+        {
+            s_eq10_state[i] = (float)s_eq10_q31_state[i] *
+                              (1.0f / (EQ10_Q31_INPUT_SCALE * 2147483648.0f));
+        }
+        #else
+        memset(s_eq10_state, 0, sizeof(s_eq10_state));
+        #endif
+    }
+
+    s_eq10_audio_mode = requested;
+}
+
+/**
+ * @brief Begin a coefficient update on the shadow bank
+ *
+ * Selects the bank not in use by the audio path, cancels any published
+ * update the audio path has not yet adopted, and seeds the shadow with
+ * the most recent coefficient content. The caller modifies the returned
+ * bank and then calls EQ10_PublishCoeffs().
+ *
+ * Safe against the audio ISR: adoption happens only at block boundaries,
+ * and the cancel/confirm sequence guarantees the ISR cannot switch onto
+ * the shadow bank while it is being written.
+ *
+ * @return Pointer to the writable shadow coefficient bank (50 floats)
+ */
+static float* EQ10_BeginCoeffUpdate(void)
+{
+    const uint32_t latest = s_eq10_published_bank;
+
+    // Pin the audio path to its current bank: cancel any outstanding
+    // publish, re-checking in case the ISR adopted it in between.
+    uint32_t in_use;
+    do
+    {
+        in_use = s_eq10_audio_bank;
+        s_eq10_published_bank = in_use;
+    } while (s_eq10_audio_bank != in_use);
+
+    s_eq10_shadow_bank = in_use ^ 1u;
+
+    // Seed the shadow with the latest published content (which may be a
+    // cancelled not-yet-adopted update, or the bank the audio path uses)
+    if (s_eq10_shadow_bank != latest)
+    {
+        memcpy(s_eq10_coeff_banks[s_eq10_shadow_bank],
+               s_eq10_coeff_banks[latest],
+               sizeof(s_eq10_coeff_banks[0]));
+    }
+
+    return s_eq10_coeff_banks[s_eq10_shadow_bank];
+}
+
+/**
+ * @brief Publish the shadow bank to the audio path
+ *
+ * Single atomic index store; the audio path picks it up at the next
+ * block boundary.
+ */
+static void EQ10_PublishCoeffs(void)
+{
+    EQ10_COMPILER_BARRIER();
+    s_eq10_published_bank = s_eq10_shadow_bank;
+}
+
+/**
+ * @brief Fire the ramp completion callback, if one is registered
+ *
+ * Runs in the audio context; the registered callback must be short and
+ * ISR-safe (set a flag, push an event).
+ */
+static inline void EQ10_RampNotifyComplete(void)
+{
+    if (s_eq10_ramp_callback != NULL)
+    {
+        s_eq10_ramp_callback(s_eq10_ramp_callback_context);
+    }
+}
+
+/**
+ * @brief Adopt the latest published coefficient bank (audio path)
+ *
+ * Called at the top of the block processing functions, so coefficient
+ * swaps only ever take effect on block boundaries.
+ */
+static inline void EQ10_AdoptCoeffs(void)
+{
+    const uint32_t published = s_eq10_published_bank;
+
+    if (published != s_eq10_audio_bank)
+    {
+        s_eq10_audio_bank = published;
+
+        for (int ch = 0; ch < s_eq10_num_instances; ch++)
+        {
+            s_eq10_instances[ch].pCoeffs = s_eq10_coeff_banks[published];
+        }
+
+        // The Q31 cascade runs from its own quantized copy; refresh it
+        // here so coefficient updates land on the same block boundary
+        // in both modes
+        if (s_eq10_audio_mode == EQ10_MODE_Q31)
+        {
+            EQ10_QuantizeCoeffs(s_eq10_coeff_banks[published]);
+        }
+
+        // An instantaneous publish supersedes any ramp in flight; the
+        // live gains become whatever the control side last requested
+        // (the dB-domain setters clear a pending ramp before publishing).
+        // The superseding bank is fully live from this block, so a
+        // waiting caller still gets its completion notification
+        if (s_eq10_ramp_active)
+        {
+            s_eq10_ramp_active = false;
+            EQ10_RampNotifyComplete();
+        }
+        memcpy(s_eq10_live_gains, s_eq10_ctrl_gains, sizeof(s_eq10_live_gains));
+    }
+}
+
+/**
+ * @brief Advance the gain ramp by one block (audio path)
+ *
+ * Called at block boundaries after EQ10_AdoptCoeffs(). Redesigns at
+ * most EQ10_RAMP_BANDS_PER_BLOCK bands per block, round-robin, from the
+ * dB value interpolated along the ramp, and writes them straight into
+ * the live coefficient bank (the control side never touches the audio
+ * path's bank, so this is safe on the single core). One RBJ design is a
+ * few hundred cycles, so the worst-case per-block cost is bounded and
+ * small against the 166k-cycle block budget.
+ *
+ * Once the interpolated value clamps at the target, one final
+ * round-robin pass (EQ10_NUM_BANDS redesigns) lands every band on the
+ * exact target design, the ramp deactivates, and the completion
+ * callback fires.
+ */
+static inline void EQ10_RampStep(void)
+{
+    if (s_eq10_ramp_pending)
+    {
+        s_eq10_ramp_pending = false;
+
+        // Retargeting mid-ramp starts from the gains currently in the
+        // live bank, so there is no jump back to the old start point
+        memcpy(s_eq10_ramp_start, s_eq10_live_gains, sizeof(s_eq10_ramp_start));
+        memcpy(s_eq10_ramp_target, s_eq10_ramp_req_gains, sizeof(s_eq10_ramp_target));
+        s_eq10_ramp_q = s_eq10_ramp_req_q;
+        s_eq10_ramp_total = s_eq10_ramp_req_blocks;
+        s_eq10_ramp_block = 0;
+        s_eq10_ramp_final = EQ10_NUM_BANDS;
+        s_eq10_ramp_active = true;
+    }
+
+    if (!s_eq10_ramp_active)
+    {
+        return;
+    }
+
+    s_eq10_ramp_block++;
+
+    float progress = (float)s_eq10_ramp_block / (float)s_eq10_ramp_total;
+    if (progress > 1.0f)
+    {
+        progress = 1.0f;
+    }
+
+    float* bank = s_eq10_coeff_banks[s_eq10_audio_bank];
+
+    for (int n = 0; n < EQ10_RAMP_BANDS_PER_BLOCK && s_eq10_ramp_active; n++)
+    {
+        const int band = s_eq10_ramp_band;
+        const float gain_dB = s_eq10_ramp_start[band] +
+                              (s_eq10_ramp_target[band] - s_eq10_ramp_start[band]) * progress;
+
+        EQ10_DesignBiquad(QUICKTUNE_BAND_FREQUENCIES[band], gain_dB, s_eq10_ramp_q,
+                          QUICKTUNE_SAMPLE_RATE, &bank[band * EQ10_COEFFS_PER_BAND]);
+        s_eq10_live_gains[band] = gain_dB;
+
+        if (s_eq10_audio_mode == EQ10_MODE_Q31)
+        {
+            EQ10_QuantizeCoeffRange(bank, band * EQ10_COEFFS_PER_BAND, EQ10_COEFFS_PER_BAND);
+        }
+
+        s_eq10_ramp_band = (band + 1) % EQ10_NUM_BANDS;
+
+        // Count down the final exact-target pass once the interpolation
+        // has clamped; after EQ10_NUM_BANDS such designs every band is
+        // on the target and the ramp is done
+        if (progress >= 1.0f)
+        {
+            s_eq10_ramp_final--;
+            if (s_eq10_ramp_final <= 0)
+            {
+                s_eq10_ramp_active = false;
+                EQ10_RampNotifyComplete();
+            }
+        }
+    }
+}
+
+/**
+ * @brief Run one channel's block through the Q31 cascade
+ *
+ * Converts float in/out around arm_biquad_cascade_df1_q31 with 6 dB of
+ * input headroom (restored on the way out), chunked through a scratch
+ * buffer sized for the standard audio block.
+ *
+ * @param channel Channel instance index
+ * @param input Input audio buffer (float32)
+ * @param output Output audio buffer (float32, may equal input)
+ * @param numSamples Number of samples to process
+ */
+QUICKTUNE_FAST_CODE static void EQ10_ProcessBlockQ31(int channel, const float* input, float* output, int numSamples)
+{
+    static q31_t scratch[QUICKTUNE_BLOCK_SIZE];
+
+    while (numSamples > 0)
+    {
+        const int chunk = (numSamples < QUICKTUNE_BLOCK_SIZE) ? numSamples : QUICKTUNE_BLOCK_SIZE;
+
+        for (int i = 0; i < chunk; i++)
+        {
+            float v = input[i] * (EQ10_Q31_INPUT_SCALE * 2147483648.0f);
+            if (v >= 2147483647.0f)  v = 2147483647.0f;
+            if (v <= -2147483648.0f) v = -2147483648.0f;
+            scratch[i] = (q31_t)v;
+        }
+
+        arm_biquad_cascade_df1_q31(&s_eq10_q31_instances[channel], scratch, scratch, chunk);
+
+        for (int i = 0; i < chunk; i++)
+        {
+            output[i] = (float)scratch[i] *
+                        (1.0f / (EQ10_Q31_INPUT_SCALE * 2147483648.0f));
+        }
+
+        input += chunk;
+        output += chunk;
+        numSamples -= chunk;
+    }
+}
+
+#if EQ10_ENABLE_LIMITER
+/**
+ * @brief Fused lookahead limiter pass over the cascade output
+ *
+ * Runs in the same block traversal as the cascade - the buffer is still
+ * hot in cache, so the stage costs only its own arithmetic (~14
+ * cycles/sample) instead of a second set of block loads/stores plus
+ * call overhead (~19 cycles/sample for the standalone pass this
+ * replaces). Instant-attack peak envelope with exponential release;
+ * the gain dives toward threshold/envelope with a time constant sized
+ * so it lands within the lookahead window, and a hard full-scale clamp
+ * backstops the residual smoothing overshoot.
+ *
+ * @param channel Channel index
+ * @param buf Cascade output, limited in place
+ * @param n Number of samples
+ */
+QUICKTUNE_FAST_CODE static void EQ10_LimiterProcessBlock(int channel, float* buf, int n)
+{
+    float* delay = s_eq10_lim_delay[channel];
+    uint32_t idx = s_eq10_lim_idx[channel];
+    float env = s_eq10_lim_env[channel];
+    float gain = s_eq10_lim_gain[channel];
+    float min_gain = 1.0f;
+
+    for (int i = 0; i < n; i++)
+    {
+        const float x = buf[i];
+
+        // Envelope: instant attack, exponential release
+        const float a = fabsf(x);
+        env *= s_eq10_lim_release;
+        if (a > env)
+        {
+            env = a;
+        }
+
+        // Target gain and asymmetric smoothing (fast dive, slow recover)
+        const float target = (env > EQ10_LIMITER_THRESHOLD)
+                                 ? EQ10_LIMITER_THRESHOLD / env
+                                 : 1.0f;
+        gain += (target - gain) * ((target < gain) ? s_eq10_lim_attack
+                                                   : s_eq10_lim_release_step);
+        if (gain < min_gain)
+        {
+            min_gain = gain;
+        }
+
+        // Apply to the delayed sample; the envelope leads the delay
+        // line by the lookahead, so the dive anticipates the peak
+        const uint32_t slot = idx & (EQ10_LIMITER_LOOKAHEAD_SAMPLES - 1);
+        float y = delay[slot] * gain;
+        delay[slot] = x;
+        idx++;
+
+        // Safety clamp at full scale
+        if (y > 1.0f)  { y = 1.0f; }
+        if (y < -1.0f) { y = -1.0f; }
+        buf[i] = y;
+    }
+
+    s_eq10_lim_idx[channel] = idx;
+    s_eq10_lim_env[channel] = env;
+    s_eq10_lim_gain[channel] = gain;
+    s_eq10_lim_min_gain[channel] = min_gain;
+}
+
+/** Clear limiter state for all channels (unity gain, empty delay) */
+static void EQ10_LimiterReset(void)
+{
+    memset(s_eq10_lim_delay, 0, sizeof(s_eq10_lim_delay));
+    memset(s_eq10_lim_idx, 0, sizeof(s_eq10_lim_idx));
+    for (int ch = 0; ch < EQ10_MAX_CHANNELS; ch++)
+    {
+        s_eq10_lim_env[ch] = 0.0f;
+        s_eq10_lim_gain[ch] = 1.0f;
+        s_eq10_lim_min_gain[ch] = 1.0f;
+    }
+}
+#endif /* EQ10_ENABLE_LIMITER */
+
 /* ============================================================================
  * PUBLIC API IMPLEMENTATION
  * ============================================================================ */
 
 void EQ10_Init(void)
 {
-    // Initialize all coefficients to unity gain (0 dB)
+    // Initialize bank 0 to unity gain (0 dB); audio is not running yet,
+    // so it is safe to write the live bank directly. The flat bank is a
+    // constexpr table (quicktune_tables.h), so boot involves no
+    // transcendental math
+    s_eq10_published_bank = 0;
+    s_eq10_audio_bank = 0;
+    s_eq10_shadow_bank = 1;
+
+    memcpy(s_eq10_coeff_banks[0], QTCT_EQ10_FLAT.c, sizeof(QTCT_EQ10_FLAT.c));
+
+    // Clear state for all channels and start in the float mode
+    memset(s_eq10_state, 0, sizeof(s_eq10_state));
+    memset(s_eq10_q31_state, 0, sizeof(s_eq10_q31_state));
+    s_eq10_mode = EQ10_MODE_F32;
+    s_eq10_audio_mode = EQ10_MODE_F32;
+
+    // No ramp in flight; gain records match the flat bank
+    s_eq10_ramp_pending = false;
+    s_eq10_ramp_active = false;
+    s_eq10_ramp_band = 0;
+    s_eq10_ramp_final = 0;
+    s_eq10_ramp_callback = NULL;
+    s_eq10_ramp_callback_context = NULL;
+    memset(s_eq10_live_gains, 0, sizeof(s_eq10_live_gains));
+    memset(s_eq10_ctrl_gains, 0, sizeof(s_eq10_ctrl_gains));
+
+    #if EQ10_ENABLE_COEFF_CACHE
+    memset(s_eq10_coeff_cache, 0, sizeof(s_eq10_coeff_cache));
+
+    #if EQ10_COEFF_CACHE_PREWARM
+    // Fill every (band, step) entry at the calibration Q so no design
+    // ever runs at control time
     for (int band = 0; band < EQ10_NUM_BANDS; band++)
     {
-        float* coeffs = &s_eq10_coeffs[band * EQ10_COEFFS_PER_BAND];
-        const float fc = QUICKTUNE_BAND_FREQUENCIES[band];
-        EQ10_DesignBiquad(fc, 0.0f, QUICKTUNE_EQ_Q, QUICKTUNE_SAMPLE_RATE, coeffs);
+        for (int step = 0; step < EQ10_CACHE_STEPS; step++)
+        {
+            float coeffs[EQ10_COEFFS_PER_BAND];
+            EQ10_DesignBiquadCached(band,
+                                    QUICKTUNE_MIN_GAIN_DB + (float)step * EQ10_COEFF_CACHE_STEP_DB,
+                                    QUICKTUNE_EQ_Q, coeffs);
+        }
     }
+    #endif
+    #endif
 
-    // Clear state
-    memset(s_eq10_state, 0, sizeof(s_eq10_state));
+    #if EQ10_ENABLE_LIMITER
+    // Smoothing coefficients: the attack lands within the lookahead
+    // window (2.2 time constants), the release recovers over
+    // EQ10_LIMITER_RELEASE_MS
+    s_eq10_lim_attack = 1.0f - expf(-2.2f / (float)EQ10_LIMITER_LOOKAHEAD_SAMPLES);
+    s_eq10_lim_release = expf(-1000.0f / (EQ10_LIMITER_RELEASE_MS *
+                                          QUICKTUNE_SAMPLE_RATE));
+    s_eq10_lim_release_step = 1.0f - s_eq10_lim_release;
+    EQ10_LimiterReset();
+    s_eq10_limiter_enabled = true;
+    #endif
 
-    // Initialize CMSIS-DSP biquad cascade
-    arm_biquad_cascade_df1_init_f32(
-        &s_eq10_instance,
-        EQ10_NUM_BANDS,      // Number of stages
-        s_eq10_coeffs,       // Coefficients
-        s_eq10_state         // State
-    );
+    #if QUICKTUNE_ENABLE_PROFILING
+    QTProf_Reset(&s_eq10_prof);
+    #endif
 
+    // Create the default mono instance (channel 0)
+    s_eq10_num_instances = 0;
     s_eq10_initialized = true;
+    EQ10_CreateInstance();
+}
+
+int EQ10_CreateInstance(void)
+{
+    if (!s_eq10_initialized || s_eq10_num_instances >= EQ10_MAX_CHANNELS)
+    {
+        return -1;
+    }
+
+    const int channel = s_eq10_num_instances++;
+    float* state = &s_eq10_state[channel * EQ10_TOTAL_STATE];
+
+    // Clear this channel's delay lines
+    memset(state, 0, EQ10_TOTAL_STATE * sizeof(float));
+
+    // Initialize CMSIS-DSP biquad cascade against the adopted coefficient bank
+    EQ10_BIQUAD_INIT(
+        &s_eq10_instances[channel],
+        EQ10_NUM_BANDS,                          // Number of stages
+        s_eq10_coeff_banks[s_eq10_audio_bank],   // Coefficients (shared)
+        state                                    // State (per channel)
+    );
+
+    // Mirror the instance on the Q31 cascade (shared quantized coefficients)
+    q31_t* q31_state = &s_eq10_q31_state[channel * EQ10_NUM_BANDS * EQ10_Q31_STATE_PER_BAND];
+    memset(q31_state, 0, EQ10_NUM_BANDS * EQ10_Q31_STATE_PER_BAND * sizeof(q31_t));
+
+    arm_biquad_cascade_df1_init_q31(
+        &s_eq10_q31_instances[channel],
+        EQ10_NUM_BANDS,
+        s_eq10_q31_coeffs,
+        q31_state,
+        EQ10_Q31_POST_SHIFT
+    );
+
+    return channel;
 }
 
 bool EQ10_SetBandGain(int band, float gain_dB, float Q)
@@ -141,10 +857,14 @@ bool EQ10_SetBandGain(int band, float gain_dB, float Q)
     if (Q > 20.0f)
         Q = 20.0f;
 
-    // Compute new coefficients
-    float* coeffs = &s_eq10_coeffs[band * EQ10_COEFFS_PER_BAND];
-    const float fc = QUICKTUNE_BAND_FREQUENCIES[band];
-    EQ10_DesignBiquad(fc, gain_dB, Q, QUICKTUNE_SAMPLE_RATE, coeffs);
+    // An instantaneous set supersedes any ramp that has not started yet
+    s_eq10_ramp_pending = false;
+
+    // Compute new coefficients into the shadow bank and publish
+    float* bank = EQ10_BeginCoeffUpdate();
+    s_eq10_ctrl_gains[band] =
+        EQ10_DesignBiquadCached(band, gain_dB, Q, &bank[band * EQ10_COEFFS_PER_BAND]);
+    EQ10_PublishCoeffs();
 
     return true;
 }
@@ -162,7 +882,12 @@ bool EQ10_SetAllGains(const float* gains_dB, float Q)
     if (Q > 20.0f)
         Q = 20.0f;
 
-    // Update all bands
+    // An instantaneous set supersedes any ramp that has not started yet
+    s_eq10_ramp_pending = false;
+
+    // Update all bands in the shadow bank, then publish once
+    float* bank = EQ10_BeginCoeffUpdate();
+
     for (int band = 0; band < EQ10_NUM_BANDS; band++)
     {
         float gain_dB = gains_dB[band];
@@ -173,16 +898,17 @@ bool EQ10_SetAllGains(const float* gains_dB, float Q)
         if (gain_dB < QUICKTUNE_MIN_GAIN_DB)
             gain_dB = QUICKTUNE_MIN_GAIN_DB;
 
-        // Compute coefficients
-        float* coeffs = &s_eq10_coeffs[band * EQ10_COEFFS_PER_BAND];
-        const float fc = QUICKTUNE_BAND_FREQUENCIES[band];
-        EQ10_DesignBiquad(fc, gain_dB, Q, QUICKTUNE_SAMPLE_RATE, coeffs);
+        // Compute coefficients (cache hit: a 20-byte copy)
+        s_eq10_ctrl_gains[band] =
+            EQ10_DesignBiquadCached(band, gain_dB, Q, &bank[band * EQ10_COEFFS_PER_BAND]);
     }
 
+    EQ10_PublishCoeffs();
+
     return true;
 }
 
-void EQ10_ProcessBlock(float* input, float* output, int numSamples)
+QUICKTUNE_FAST_CODE void EQ10_ProcessBlock(float* input, float* output, int numSamples)
 {
     if (!s_eq10_initialized)
     {
@@ -194,17 +920,100 @@ void EQ10_ProcessBlock(float* input, float* output, int numSamples)
         return;
     }
 
-    // Process through biquad cascade using CMSIS-DSP
-    // CPU: ~20 cycles/sample/stage × 10 stages = 200 cycles/sample
-    // For 32 samples: 6400 cycles = 25.6 µs @ 250 MHz = 3.8% CPU
-    arm_biquad_cascade_df1_f32(&s_eq10_instance, input, output, numSamples);
+    // Pick up any mode switch / coefficient update / ramp step published
+    // since the last block
+    EQ10_AdoptMode();
+    EQ10_AdoptCoeffs();
+    EQ10_RampStep();
+
+    #if QUICKTUNE_ENABLE_PROFILING
+    const uint32_t prof_t0 = QTProf_Cycles();
+    #endif
+
+    if (s_eq10_audio_mode == EQ10_MODE_Q31)
+    {
+        EQ10_ProcessBlockQ31(0, input, output, numSamples);
+    }
+    else
+    {
+        // Process through biquad cascade using CMSIS-DSP
+        // CPU: ~20 cycles/sample/stage × 10 stages = 200 cycles/sample
+        // For 32 samples: 6400 cycles = 25.6 µs @ 250 MHz = 3.8% CPU
+        EQ10_BIQUAD_PROCESS(&s_eq10_instances[0], input, output, numSamples);
+    }
+
+    #if EQ10_ENABLE_LIMITER
+    // 11th processing step over the output block while it is hot in
+    // cache; counted inside the profiling window as part of the
+    // combined block cost
+    if (s_eq10_limiter_enabled)
+    {
+        EQ10_LimiterProcessBlock(0, output, numSamples);
+    }
+    #endif
+
+    #if QUICKTUNE_ENABLE_PROFILING
+    QTProf_Update(&s_eq10_prof, QTProf_Cycles() - prof_t0);
+    #endif
+}
+
+QUICKTUNE_FAST_CODE void EQ10_ProcessBlockMulti(float** channels, int numChannels, int numSamples)
+{
+    if (!s_eq10_initialized || channels == NULL)
+    {
+        return;
+    }
+
+    if (numChannels > EQ10_MAX_CHANNELS)
+    {
+        numChannels = EQ10_MAX_CHANNELS;
+    }
+
+    // Create missing channel instances on demand
+    while (s_eq10_num_instances < numChannels)
+    {
+        EQ10_CreateInstance();
+    }
+
+    // Pick up any mode switch / coefficient update / ramp step published
+    // since the last block
+    EQ10_AdoptMode();
+    EQ10_AdoptCoeffs();
+    EQ10_RampStep();
+
+    // Process each channel in place against the shared coefficient bank.
+    // Coefficients stay hot in cache after the first channel, so each
+    // additional channel costs well under the full mono cascade.
+    #if EQ10_ENABLE_LIMITER
+    const bool limiter_on = s_eq10_limiter_enabled;
+    #endif
+
+    for (int ch = 0; ch < numChannels; ch++)
+    {
+        if (s_eq10_audio_mode == EQ10_MODE_Q31)
+        {
+            EQ10_ProcessBlockQ31(ch, channels[ch], channels[ch], numSamples);
+        }
+        else
+        {
+            EQ10_BIQUAD_PROCESS(&s_eq10_instances[ch], channels[ch], channels[ch], numSamples);
+        }
+
+        #if EQ10_ENABLE_LIMITER
+        if (limiter_on)
+        {
+            EQ10_LimiterProcessBlock(ch, channels[ch], numSamples);
+        }
+        #endif
+    }
 }
 
 void EQ10_GetCoefficients(float* coeffs)
 {
     if (coeffs != NULL)
     {
-        memcpy(coeffs, s_eq10_coeffs, sizeof(s_eq10_coeffs));
+        // Read the most recently published bank
+        memcpy(coeffs, s_eq10_coeff_banks[s_eq10_published_bank], sizeof(s_eq10_coeff_banks[0]));
     }
 }
 
@@ -215,24 +1024,159 @@ bool EQ10_SetCoefficients(const float* coeffs)
         return false;
     }
 
-    // Copy coefficients
-    memcpy(s_eq10_coeffs, coeffs, sizeof(s_eq10_coeffs));
+    // An instantaneous set supersedes any ramp that has not started yet
+    s_eq10_ramp_pending = false;
 
-    // Reinitialize CMSIS-DSP instance with new coefficients
-    arm_biquad_cascade_df1_init_f32(
-        &s_eq10_instance,
-        EQ10_NUM_BANDS,
-        s_eq10_coeffs,
-        s_eq10_state
-    );
+    // Write the full set into the shadow bank and publish
+    float* bank = EQ10_BeginCoeffUpdate();
+    memcpy(bank, coeffs, sizeof(s_eq10_coeff_banks[0]));
+    EQ10_PublishCoeffs();
 
     return true;
 }
 
+bool EQ10_RampToGains(const float* gains_dB, float Q, int numBlocks)
+{
+    if (!s_eq10_initialized || gains_dB == NULL || numBlocks < 1)
+    {
+        return false;
+    }
+
+    // Clip Q to safe range
+    if (Q < 0.1f)
+        Q = 0.1f;
+    if (Q > 20.0f)
+        Q = 20.0f;
+
+    for (int band = 0; band < EQ10_NUM_BANDS; band++)
+    {
+        float gain_dB = gains_dB[band];
+
+        // Clip gain to safe range
+        if (gain_dB > QUICKTUNE_MAX_GAIN_DB)
+            gain_dB = QUICKTUNE_MAX_GAIN_DB;
+        if (gain_dB < QUICKTUNE_MIN_GAIN_DB)
+            gain_dB = QUICKTUNE_MIN_GAIN_DB;
+
+        #if EQ10_ENABLE_COEFF_CACHE
+        // Land on the cache grid, so the ramp endpoint matches what the
+        // instantaneous setters would realize for the same gains
+        gain_dB = EQ10_CacheQuantizeGain(gain_dB);
+        #endif
+
+        s_eq10_ramp_req_gains[band] = gain_dB;
+        s_eq10_ctrl_gains[band] = gain_dB;
+    }
+
+    s_eq10_ramp_req_q = Q;
+    s_eq10_ramp_req_blocks = (uint32_t)numBlocks;
+
+    // Flag last, so the audio path never adopts a half-written request
+    EQ10_COMPILER_BARRIER();
+    s_eq10_ramp_pending = true;
+
+    return true;
+}
+
+bool EQ10_IsRamping(void)
+{
+    return s_eq10_ramp_pending || s_eq10_ramp_active;
+}
+
+void EQ10_SetRampCompleteCallback(EQ10RampCompleteCallback callback, void* context)
+{
+    // Context first, so the audio path never pairs the new callback
+    // with a stale context
+    s_eq10_ramp_callback_context = context;
+    EQ10_COMPILER_BARRIER();
+    s_eq10_ramp_callback = callback;
+}
+
+void EQ10_RampService(void)
+{
+    if (!s_eq10_initialized)
+    {
+        return;
+    }
+
+    // Same block-boundary sequence as the processing functions, without
+    // touching audio - for hosts that pace the ramp from another
+    // block-rate context while the cascade itself is not running
+    EQ10_AdoptMode();
+    EQ10_AdoptCoeffs();
+    EQ10_RampStep();
+}
+
+bool EQ10_SetProcessingMode(EQ10ProcessingMode mode)
+{
+    if (!s_eq10_initialized)
+    {
+        return false;
+    }
+
+    // Single store; the audio path adopts it (and performs any state
+    // conversion) at the next block boundary
+    EQ10_COMPILER_BARRIER();
+    s_eq10_mode = mode;
+
+    return true;
+}
+
+EQ10ProcessingMode EQ10_GetProcessingMode(void)
+{
+    return s_eq10_mode;
+}
+
+void EQ10_SetLimiterEnabled(bool enabled)
+{
+    #if EQ10_ENABLE_LIMITER
+    if (enabled && !s_eq10_limiter_enabled)
+    {
+        // Publish fresh state before the audio path can see the flag
+        EQ10_LimiterReset();
+        EQ10_COMPILER_BARRIER();
+    }
+    s_eq10_limiter_enabled = enabled;
+    if (!enabled)
+    {
+        for (int ch = 0; ch < EQ10_MAX_CHANNELS; ch++)
+        {
+            s_eq10_lim_min_gain[ch] = 1.0f;
+        }
+    }
+    #else
+    (void)enabled;
+    #endif
+}
+
+float EQ10_GetLimiterGainReduction(void)
+{
+    #if EQ10_ENABLE_LIMITER
+    float min_gain = 1.0f;
+
+    for (int ch = 0; ch < EQ10_MAX_CHANNELS; ch++)
+    {
+        const float g = s_eq10_lim_min_gain[ch];
+        if (g < min_gain)
+        {
+            min_gain = g;
+        }
+    }
+
+    return (min_gain < 1.0f) ? -20.0f * log10f(min_gain) : 0.0f;
+    #else
+    return 0.0f;
+    #endif
+}
+
 void EQ10_Reset(void)
 {
-    // Clear state (delay lines)
+    // Clear state (delay lines) for all channels, both numeric paths
     memset(s_eq10_state, 0, sizeof(s_eq10_state));
+    memset(s_eq10_q31_state, 0, sizeof(s_eq10_q31_state));
+    #if EQ10_ENABLE_LIMITER
+    EQ10_LimiterReset();
+    #endif
 }
 
 float EQ10_GetBandFrequency(int band)
@@ -244,3 +1188,20 @@ float EQ10_GetBandFrequency(int band)
 
     return QUICKTUNE_BAND_FREQUENCIES[band];
 }
+
+#if QUICKTUNE_ENABLE_PROFILING
+
+void EQ10_GetProfile(QTProf_Counter* out)
+{
+    if (out != NULL)
+    {
+        *out = s_eq10_prof;
+    }
+}
+
+void EQ10_ResetProfile(void)
+{
+    QTProf_Reset(&s_eq10_prof);
+}
+
+#endif /* QUICKTUNE_ENABLE_PROFILING */
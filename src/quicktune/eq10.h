@@ -2,8 +2,11 @@
  * @file eq10.h
  * @brief 10-Band Parametric EQ using CMSIS-DSP
  *
- * Implements a cascade of 10 biquad parametric EQ stages using
- * ARM CMSIS-DSP library (arm_biquad_cascade_df1_f32).
+ * Implements a cascade of 10 biquad parametric EQ stages using the
+ * ARM CMSIS-DSP library. The cascade backend (Direct Form I or
+ * Transposed Direct Form II) is selected at compile time via
+ * EQ10_BACKEND in quicktune_config.h; the coefficient and preset
+ * format is identical for both.
  *
  * @author DSP Team (Implementation Agent)
  * @date 2026-02-09
@@ -21,6 +24,7 @@ extern "C" {
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "quicktune_config.h"
 
 /* ============================================================================
  * CONSTANTS
@@ -29,22 +33,37 @@ extern "C" {
 /** Number of EQ bands */
 #define EQ10_NUM_BANDS              10
 
-/** Number of coefficients per biquad (b0, b1, b2, a1, a2) */
+/** Number of coefficients per biquad (b0, b1, b2, a1, a2 - same for both backends) */
 #define EQ10_COEFFS_PER_BAND        5
 
 /** Total number of coefficients */
 #define EQ10_TOTAL_COEFFS           (EQ10_NUM_BANDS * EQ10_COEFFS_PER_BAND)
 
-/** Number of state variables per biquad */
-#define EQ10_STATE_PER_BAND         2
+/** Number of state variables per biquad (backend-dependent CMSIS layout) */
+#if EQ10_BACKEND == EQ10_BACKEND_DF2T
+#define EQ10_STATE_PER_BAND         2   /* DF2T: d1, d2 */
+#else
+#define EQ10_STATE_PER_BAND         4   /* DF1: x[n-1], x[n-2], y[n-1], y[n-2] */
+#endif
 
-/** Total number of state variables */
+/** Total number of state variables (per channel) */
 #define EQ10_TOTAL_STATE            (EQ10_NUM_BANDS * EQ10_STATE_PER_BAND)
 
+/** Maximum number of channel instances (stereo + sub for the 2.1 SKU) */
+#define EQ10_MAX_CHANNELS           3
+
 /* ============================================================================
  * PUBLIC API
  * ============================================================================ */
 
+/**
+ * @brief Numeric processing mode
+ */
+typedef enum {
+    EQ10_MODE_F32,  /**< Float cascade (default; FPU active) */
+    EQ10_MODE_Q31   /**< Fixed-point Q31 cascade (low-power mode; FPU can be gated) */
+} EQ10ProcessingMode;
+
 /**
  * @brief Initialize EQ10 with flat (bypass) response
  *
@@ -57,7 +76,9 @@ void EQ10_Init(void);
  * @brief Set gain for a single EQ band
  *
  * Updates the biquad coefficients for one band using RBJ cookbook formulas.
- * Changes take effect immediately on next ProcessBlock call.
+ * The update is written to a shadow coefficient bank and published with an
+ * atomic swap, so it is safe to call from the control task while audio is
+ * running; it takes effect on the next ProcessBlock call.
  *
  * @param band Band index (0-9)
  * @param gain_dB Gain in dB (-12 to +12 recommended)
@@ -80,6 +101,75 @@ bool EQ10_SetBandGain(int band, float gain_dB, float Q);
  */
 bool EQ10_SetAllGains(const float* gains_dB, float Q);
 
+/**
+ * @brief Ramp all bands to new target gains over numBlocks blocks
+ *
+ * Click-free alternative to EQ10_SetAllGains() for use while audio is
+ * playing: the audio path interpolates each band's gain in dB along the
+ * ramp and redesigns AT MOST ONE band per block (round-robin), so the
+ * per-block cost stays bounded at a single RBJ design (~a few hundred
+ * cycles). After the interpolation reaches the target a final
+ * round-robin pass lands every band on the exact target design, so the
+ * full ramp spans numBlocks + 9 blocks (~0.67 ms per block at 48 kHz /
+ * 32 samples).
+ *
+ * Calling again while a ramp is active retargets it smoothly from the
+ * current interpolated gains. EQ10_SetBandGain(), EQ10_SetAllGains()
+ * and EQ10_SetCoefficients() supersede (cancel) an active ramp.
+ *
+ * @param gains_dB Array of 10 target gains in dB (clipped to +/-12 dB)
+ * @param Q Quality factor (same for all bands)
+ * @param numBlocks Ramp length in audio blocks (>= 1)
+ *
+ * @return true if the ramp was queued, false if invalid parameters
+ */
+bool EQ10_RampToGains(const float* gains_dB, float Q, int numBlocks);
+
+/**
+ * @brief Check whether a gain ramp is queued or in progress
+ *
+ * @return true while a ramp started by EQ10_RampToGains() is running
+ */
+bool EQ10_IsRamping(void);
+
+/**
+ * @brief Ramp completion callback
+ *
+ * Invoked from the AUDIO context at the block boundary on which the
+ * last band of a ramp lands on its exact target design (or on which an
+ * instantaneous publish supersedes the ramp - either way the response
+ * is fully live). Keep it short and ISR-safe: set a flag or push an
+ * event, never block or redesign filters inside it.
+ *
+ * @param context Opaque pointer passed to EQ10_SetRampCompleteCallback()
+ */
+typedef void (*EQ10RampCompleteCallback)(void* context);
+
+/**
+ * @brief Register a ramp completion callback (control side)
+ *
+ * Lets a state machine sequence work against the amortized coefficient
+ * scheduler - e.g. QuickTune delays the next measurement iteration
+ * until the applied correction is fully live. Pass NULL to unregister.
+ * EQ10_Init() clears any registered callback.
+ *
+ * @param callback Function to call on ramp completion (audio context)
+ * @param context Opaque pointer handed back to the callback
+ */
+void EQ10_SetRampCompleteCallback(EQ10RampCompleteCallback callback, void* context);
+
+/**
+ * @brief Advance the coefficient scheduler without processing audio
+ *
+ * Runs the same block-boundary adoption and ramp step as
+ * EQ10_ProcessBlock(). Call once per block from the audio context when
+ * a ramp must make progress while the cascade itself is not being run
+ * (QuickTune does this while applying correction mid-calibration).
+ * Calling it in the same block as EQ10_ProcessBlock() is harmless - the
+ * ramp just advances faster.
+ */
+void EQ10_RampService(void);
+
 /**
  * @brief Process audio block through EQ10
  *
@@ -91,9 +181,38 @@ bool EQ10_SetAllGains(const float* gains_dB, float Q);
  * @param numSamples Number of samples to process (typically 32)
  *
  * @note Input and output can be the same buffer (in-place processing)
+ * @note Processes channel instance 0 (mono / left channel)
  */
 void EQ10_ProcessBlock(float* input, float* output, int numSamples);
 
+/**
+ * @brief Create an additional channel instance
+ *
+ * Allocates the next channel slot from the static instance pool.
+ * All channels share one coefficient bank (the room correction is
+ * identical per channel); only the biquad delay lines are per-channel,
+ * laid out contiguously so neighbouring channels share cache lines.
+ *
+ * Instance 0 is created automatically by EQ10_Init().
+ *
+ * @return Channel index (0 to EQ10_MAX_CHANNELS-1), or -1 if pool exhausted
+ */
+int EQ10_CreateInstance(void);
+
+/**
+ * @brief Process a multi-channel audio block through EQ10
+ *
+ * Applies the shared 10-band correction to each channel in place.
+ * Channel instances are created on demand up to EQ10_MAX_CHANNELS.
+ * The shared coefficient bank stays hot in cache across channels, so
+ * stereo costs well under 2x the mono cascade.
+ *
+ * @param channels Array of numChannels pointers to per-channel buffers (float32)
+ * @param numChannels Number of channels (1 to EQ10_MAX_CHANNELS)
+ * @param numSamples Number of samples per channel (typically 32)
+ */
+void EQ10_ProcessBlockMulti(float** channels, int numChannels, int numSamples);
+
 /**
  * @brief Get current EQ10 coefficients
  *
@@ -116,6 +235,62 @@ void EQ10_GetCoefficients(float* coeffs);
  */
 bool EQ10_SetCoefficients(const float* coeffs);
 
+/**
+ * @brief Switch between float and Q31 processing
+ *
+ * Selects the numeric backend for the block processing calls. The
+ * switch is published to the audio path and takes effect at the next
+ * block boundary - no muting, no gap. When the float backend is DF1
+ * the delay-line state is converted across so the switch is seamless;
+ * with the DF2T float backend the Q31 delay lines restart from zero
+ * (the forms' states are not interconvertible), which is inaudible at
+ * the low levels where eco mode engages.
+ *
+ * The Q31 cascade runs the same coefficients quantized to Q1.30
+ * (post-shift 1 covers the |a1| < 2 range of the 25 Hz band) and stays
+ * within 0.1 dB of the float magnitude response across all bands.
+ *
+ * @param mode EQ10_MODE_F32 or EQ10_MODE_Q31
+ *
+ * @return true if successful, false if not initialized
+ */
+bool EQ10_SetProcessingMode(EQ10ProcessingMode mode);
+
+/**
+ * @brief Get the active numeric processing mode
+ *
+ * @return Current mode as last requested via EQ10_SetProcessingMode()
+ */
+EQ10ProcessingMode EQ10_GetProcessingMode(void);
+
+/**
+ * @brief Enable or disable the fused output limiter
+ *
+ * The limiter (EQ10_ENABLE_LIMITER) runs as an 11th processing step
+ * inside the same block traversal as the cascade: a lookahead peak
+ * limiter at EQ10_LIMITER_THRESHOLD with a hard full-scale clamp as a
+ * safety net. Enabling adds EQ10_LIMITER_LOOKAHEAD_SAMPLES (667 us) of
+ * output latency; disabling bypasses the stage entirely, including the
+ * delay line. Enabled by default after EQ10_Init().
+ *
+ * Takes effect at the next block boundary. No-op when the limiter is
+ * compiled out.
+ *
+ * @param enabled true to engage the limiter stage
+ */
+void EQ10_SetLimiterEnabled(bool enabled);
+
+/**
+ * @brief Current limiter gain reduction (dB)
+ *
+ * Deepest gain reduction applied during the most recent processed
+ * block, for metering. 0.0 when the limiter is idle, disabled or
+ * compiled out.
+ *
+ * @return Gain reduction in dB (>= 0.0)
+ */
+float EQ10_GetLimiterGainReduction(void);
+
 /**
  * @brief Reset EQ10 state (clear delay lines)
  *
@@ -132,6 +307,27 @@ void EQ10_Reset(void);
  */
 float EQ10_GetBandFrequency(int band);
 
+#if QUICKTUNE_ENABLE_PROFILING
+
+#include "quicktune_profile.h"
+
+/**
+ * @brief Get raw cycle counter for EQ10_ProcessBlock
+ *
+ * Snapshot of the DWT-measured per-block cost of the cascade.
+ * Aggregated into QuickTune_GetPerfStats().
+ *
+ * @param out Output counter snapshot
+ */
+void EQ10_GetProfile(QTProf_Counter* out);
+
+/**
+ * @brief Reset the EQ10 cycle counter
+ */
+void EQ10_ResetProfile(void);
+
+#endif /* QUICKTUNE_ENABLE_PROFILING */
+
 #ifdef __cplusplus
 }
 #endif
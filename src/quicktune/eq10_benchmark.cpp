@@ -0,0 +1,140 @@
+/**
+ * @file eq10_benchmark.cpp
+ * @brief EQ10 Backend Benchmark (DF1 vs DF2T)
+ *
+ * Measures cycles per 32-sample block for the active EQ10 cascade
+ * backend. Build the module twice (-DEQ10_BACKEND=EQ10_BACKEND_DF1 and
+ * -DEQ10_BACKEND=EQ10_BACKEND_DF2T) and compare the reported numbers to
+ * quantify the headroom reclaimed by the DF2T kernel.
+ *
+ * On target the DWT cycle counter is used; on a desktop host the
+ * wall-clock fallback reports nanoseconds per block instead.
+ *
+ * Optional - not built into the production binary (see Makefile).
+ *
+ * @author DSP Team (Implementation Agent)
+ * @date 2026-02-09
+ * @target STM32H562 (Cortex-M33, 250 MHz)
+ *
+ * CONFIDENTIAL - Binary-only delivery
+ */
+
+#include "eq10.h"
+#include "quicktune_config.h"
+#include <stdio.h>
+#include <math.h>
+
+#ifdef ARM_MATH_CM33
+
+/* DWT cycle counter access (CoreDebug + DWT, Cortex-M33) */
+#define BENCH_DEMCR         (*(volatile uint32_t*)0xE000EDFC)
+#define BENCH_DWT_CTRL      (*(volatile uint32_t*)0xE0001000)
+#define BENCH_DWT_CYCCNT    (*(volatile uint32_t*)0xE0001004)
+
+static void Bench_TimerInit(void)
+{
+    BENCH_DEMCR |= (1u << 24);      /* TRCENA */
+    BENCH_DWT_CYCCNT = 0;
+    BENCH_DWT_CTRL |= 1u;           /* CYCCNTENA */
+}
+
+static uint32_t Bench_TimerGet(void)
+{
+    return BENCH_DWT_CYCCNT;
+}
+
+#define BENCH_UNIT          "cycles"
+
+#else
+
+/* Host fallback: wall-clock nanoseconds */
+#include <time.h>
+
+static void Bench_TimerInit(void)
+{
+}
+
+static uint32_t Bench_TimerGet(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000000L + ts.tv_nsec);
+}
+
+#define BENCH_UNIT          "ns"
+
+#endif /* ARM_MATH_CM33 */
+
+/** Number of blocks per measurement run */
+#define BENCH_NUM_BLOCKS    10000
+
+/**
+ * @brief Benchmark the active EQ10 backend
+ *
+ * Runs a representative ±6 dB correction curve over BENCH_NUM_BLOCKS
+ * blocks of band-limited noise and reports min/avg per-block cost.
+ */
+void EQ10_Benchmark_Run(void)
+{
+    static const float gains[EQ10_NUM_BANDS] = {
+        -6.0f, -4.0f, -2.0f, 0.0f, 2.0f, 4.0f, 6.0f, 4.0f, 2.0f, 0.0f
+    };
+
+    float buffer[QUICKTUNE_BLOCK_SIZE];
+
+    EQ10_Init();
+    EQ10_SetAllGains(gains, QUICKTUNE_EQ_Q);
+
+    // Deterministic pseudo-noise input
+    uint32_t seed = 0x12345678u;
+    for (int i = 0; i < QUICKTUNE_BLOCK_SIZE; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        buffer[i] = ((float)(seed >> 8) / (float)(1u << 24)) - 0.5f;
+    }
+
+    Bench_TimerInit();
+
+    uint32_t min_cost = 0xFFFFFFFFu;
+    uint64_t total_cost = 0;
+
+    for (int block = 0; block < BENCH_NUM_BLOCKS; block++)
+    {
+        const uint32_t t0 = Bench_TimerGet();
+        EQ10_ProcessBlock(buffer, buffer, QUICKTUNE_BLOCK_SIZE);
+        const uint32_t cost = Bench_TimerGet() - t0;
+
+        if (cost < min_cost)
+        {
+            min_cost = cost;
+        }
+        total_cost += cost;
+    }
+
+    const float avg_cost = (float)total_cost / (float)BENCH_NUM_BLOCKS;
+
+    printf("EQ10 backend: %s\n",
+           (EQ10_BACKEND == EQ10_BACKEND_DF2T) ? "DF2T" : "DF1");
+    printf("State memory: %d floats/channel\n", EQ10_TOTAL_STATE);
+    printf("Per block (%d samples): min %lu %s, avg %.1f %s\n",
+           QUICKTUNE_BLOCK_SIZE,
+           (unsigned long)min_cost, BENCH_UNIT,
+           avg_cost, BENCH_UNIT);
+}
+
+#ifdef EQ10_BENCHMARK_STANDALONE
+
+/**
+ * @brief Main entry point (for desktop or bare-metal test builds)
+ */
+int main(void)
+{
+    printf("EQ10 Backend Benchmark\n");
+    printf("======================\n\n");
+
+    EQ10_Benchmark_Run();
+
+    return 0;
+}
+
+#endif /* EQ10_BENCHMARK_STANDALONE */
@@ -0,0 +1,260 @@
+/**
+ * @file host/arm_math.h
+ * @brief Portable CMSIS-DSP subset for host-side builds
+ *
+ * Plain-C implementations of the CMSIS-DSP kernels QuickTune uses, so
+ * the module compiles and runs on a desktop toolchain (make bench)
+ * without the ARM toolchain or the prebuilt CMSIS-DSP library. This
+ * header is only on the include path for host builds (-Ihost); target
+ * builds pick up the real CMSIS-DSP headers and NEON/Helium-free
+ * reference behavior is bit-compatible in f32 and within 1 LSB in q31.
+ *
+ * Covered kernels:
+ * - arm_biquad_cascade_df1_f32 / arm_biquad_cascade_df2T_f32
+ * - arm_biquad_cascade_df1_q31 (with post-shift)
+ * - arm_fir_decimate_f32
+ *
+ * @author DSP Team (Implementation Agent)
+ * @date 2026-02-09
+ *
+ * CONFIDENTIAL - Binary-only delivery
+ */
+
+#ifndef QUICKTUNE_HOST_ARM_MATH_H
+#define QUICKTUNE_HOST_ARM_MATH_H
+
+#include <stdint.h>
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+typedef float float32_t;
+typedef int32_t q31_t;
+
+typedef enum
+{
+    ARM_MATH_SUCCESS = 0,
+    ARM_MATH_LENGTH_ERROR = -3
+} arm_status;
+
+/* ============================================================================
+ * BIQUAD CASCADE - DIRECT FORM I, FLOAT32
+ * ============================================================================ */
+
+typedef struct
+{
+    uint32_t numStages;
+    float32_t *pState;
+    const float32_t *pCoeffs;
+} arm_biquad_casd_df1_inst_f32;
+
+static inline void arm_biquad_cascade_df1_init_f32(arm_biquad_casd_df1_inst_f32 *S,
+                                                   uint8_t numStages,
+                                                   const float32_t *pCoeffs,
+                                                   float32_t *pState)
+{
+    S->numStages = numStages;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+}
+
+static inline void arm_biquad_cascade_df1_f32(const arm_biquad_casd_df1_inst_f32 *S,
+                                              const float32_t *pSrc,
+                                              float32_t *pDst,
+                                              uint32_t blockSize)
+{
+    const float32_t *c = S->pCoeffs;
+    float32_t *st = S->pState;
+
+    for (uint32_t stage = 0; stage < S->numStages; stage++)
+    {
+        const float32_t b0 = c[0], b1 = c[1], b2 = c[2], a1 = c[3], a2 = c[4];
+        float32_t x1 = st[0], x2 = st[1], y1 = st[2], y2 = st[3];
+
+        for (uint32_t i = 0; i < blockSize; i++)
+        {
+            const float32_t x0 = pSrc[i];
+            const float32_t y0 = b0 * x0 + b1 * x1 + b2 * x2 + a1 * y1 + a2 * y2;
+            x2 = x1; x1 = x0;
+            y2 = y1; y1 = y0;
+            pDst[i] = y0;
+        }
+
+        st[0] = x1; st[1] = x2; st[2] = y1; st[3] = y2;
+        st += 4;
+        c += 5;
+        pSrc = pDst;
+    }
+}
+
+/* ============================================================================
+ * BIQUAD CASCADE - TRANSPOSED DIRECT FORM II, FLOAT32
+ * ============================================================================ */
+
+typedef struct
+{
+    uint8_t numStages;
+    float32_t *pState;
+    const float32_t *pCoeffs;
+} arm_biquad_cascade_df2T_instance_f32;
+
+static inline void arm_biquad_cascade_df2T_init_f32(arm_biquad_cascade_df2T_instance_f32 *S,
+                                                    uint8_t numStages,
+                                                    const float32_t *pCoeffs,
+                                                    float32_t *pState)
+{
+    S->numStages = numStages;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+}
+
+static inline void arm_biquad_cascade_df2T_f32(const arm_biquad_cascade_df2T_instance_f32 *S,
+                                               const float32_t *pSrc,
+                                               float32_t *pDst,
+                                               uint32_t blockSize)
+{
+    const float32_t *c = S->pCoeffs;
+    float32_t *st = S->pState;
+
+    for (uint32_t stage = 0; stage < S->numStages; stage++)
+    {
+        const float32_t b0 = c[0], b1 = c[1], b2 = c[2], a1 = c[3], a2 = c[4];
+        float32_t d1 = st[0], d2 = st[1];
+
+        for (uint32_t i = 0; i < blockSize; i++)
+        {
+            const float32_t x0 = pSrc[i];
+            const float32_t y0 = b0 * x0 + d1;
+            d1 = b1 * x0 + a1 * y0 + d2;
+            d2 = b2 * x0 + a2 * y0;
+            pDst[i] = y0;
+        }
+
+        st[0] = d1; st[1] = d2;
+        st += 2;
+        c += 5;
+        pSrc = pDst;
+    }
+}
+
+/* ============================================================================
+ * BIQUAD CASCADE - DIRECT FORM I, Q31
+ * ============================================================================ */
+
+typedef struct
+{
+    uint32_t numStages;
+    q31_t *pState;
+    const q31_t *pCoeffs;
+    int8_t postShift;
+} arm_biquad_casd_df1_inst_q31;
+
+static inline void arm_biquad_cascade_df1_init_q31(arm_biquad_casd_df1_inst_q31 *S,
+                                                   uint8_t numStages,
+                                                   const q31_t *pCoeffs,
+                                                   q31_t *pState,
+                                                   int8_t postShift)
+{
+    S->numStages = numStages;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->postShift = postShift;
+}
+
+static inline void arm_biquad_cascade_df1_q31(const arm_biquad_casd_df1_inst_q31 *S,
+                                              const q31_t *pSrc,
+                                              q31_t *pDst,
+                                              uint32_t blockSize)
+{
+    const q31_t *c = S->pCoeffs;
+    q31_t *st = S->pState;
+    const int shift = S->postShift;
+
+    for (uint32_t stage = 0; stage < S->numStages; stage++)
+    {
+        const int64_t b0 = c[0], b1 = c[1], b2 = c[2], a1 = c[3], a2 = c[4];
+        q31_t x1 = st[0], x2 = st[1], y1 = st[2], y2 = st[3];
+
+        for (uint32_t i = 0; i < blockSize; i++)
+        {
+            const q31_t x0 = pSrc[i];
+            const int64_t acc = b0 * x0 + b1 * x1 + b2 * x2 + a1 * y1 + a2 * y2;
+            const q31_t y0 = (q31_t)((acc >> 31) << shift);
+            x2 = x1; x1 = x0;
+            y2 = y1; y1 = y0;
+            pDst[i] = y0;
+        }
+
+        st[0] = x1; st[1] = x2; st[2] = y1; st[3] = y2;
+        st += 4;
+        c += 5;
+        pSrc = pDst;
+    }
+}
+
+/* ============================================================================
+ * FIR DECIMATOR - FLOAT32
+ * ============================================================================ */
+
+typedef struct
+{
+    uint16_t numTaps;
+    uint8_t M;
+    const float32_t *pCoeffs;
+    float32_t *pState;
+} arm_fir_decimate_instance_f32;
+
+static inline arm_status arm_fir_decimate_init_f32(arm_fir_decimate_instance_f32 *S,
+                                                   uint16_t numTaps,
+                                                   uint8_t M,
+                                                   const float32_t *pCoeffs,
+                                                   float32_t *pState,
+                                                   uint32_t blockSize)
+{
+    if ((blockSize % M) != 0)
+    {
+        return ARM_MATH_LENGTH_ERROR;
+    }
+
+    S->numTaps = numTaps;
+    S->M = M;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    return ARM_MATH_SUCCESS;
+}
+
+static inline void arm_fir_decimate_f32(const arm_fir_decimate_instance_f32 *S,
+                                        const float32_t *pSrc,
+                                        float32_t *pDst,
+                                        uint32_t blockSize)
+{
+    /* pState holds numTaps + blockSize - 1 samples; history at the front */
+    float32_t *state = S->pState;
+    const uint32_t numTaps = S->numTaps;
+
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        state[numTaps - 1 + i] = pSrc[i];
+    }
+
+    const uint32_t outCount = blockSize / S->M;
+    for (uint32_t o = 0; o < outCount; o++)
+    {
+        float32_t acc = 0.0f;
+        const float32_t *px = &state[o * S->M + numTaps - 1];
+        for (uint32_t t = 0; t < numTaps; t++)
+        {
+            acc += S->pCoeffs[t] * px[-(int32_t)t];
+        }
+        pDst[o] = acc;
+    }
+
+    for (uint32_t i = 0; i < numTaps - 1; i++)
+    {
+        state[i] = state[blockSize + i];
+    }
+}
+
+#endif /* QUICKTUNE_HOST_ARM_MATH_H */
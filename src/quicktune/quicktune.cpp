@@ -23,21 +23,148 @@
 
 #include "quicktune.h"
 #include "quicktune_config.h"
+#include "quicktune_profile.h"
+#include "quicktune_tables.h"
 #include "eq10.h"
 #include "arm_math.h"  // CMSIS-DSP
 #include <math.h>
+#include <stddef.h>
 #include <string.h>
 
 /* ============================================================================
  * PRIVATE STATE
  * ============================================================================ */
 
+/**
+ * Compiler barrier: keeps the compiler from reordering state writes
+ * past an enable-flag store (same single-core reasoning as the EQ10
+ * coefficient publish in eq10.cpp).
+ */
+#define QUICKTUNE_COMPILER_BARRIER()    __asm volatile("" ::: "memory")
+
+/* --------------------------------------------------------------------------
+ * CONTROL EVENT QUEUE (AUDIO ISR -> CONTROL TASK)
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Events the audio ISR posts for QuickTune_ControlTask(). The queue is
+ * a lock-free single-producer/single-consumer ring: the ISR writes the
+ * slot then advances the head, the control task reads the slot then
+ * advances the tail, and each index has exactly one writer - no
+ * locking, no disabled interrupts.
+ */
+typedef enum {
+    QT_CTRL_EVENT_PASS_COMPLETE = 1,    /**< Measurement pass finished */
+    QT_CTRL_EVENT_APPLY_COMPLETE = 2,   /**< Applied correction fully live in EQ10 */
+    QT_CTRL_EVENT_DIAG_WINDOW = 3       /**< Diagnostic spectrum window ready to finalize */
+} QtCtrlEvent;
+
+static volatile uint8_t s_ctrl_queue[QUICKTUNE_CONTROL_QUEUE_LEN];
+static volatile uint32_t s_ctrl_queue_head = 0;     /* written by the ISR */
+static volatile uint32_t s_ctrl_queue_tail = 0;     /* written by the control task */
+
+/** Post an event from the audio ISR (dropped if the queue is full) */
+static inline void CtrlQueue_Push(QtCtrlEvent event)
+{
+    const uint32_t head = s_ctrl_queue_head;
+    if ((head - s_ctrl_queue_tail) < QUICKTUNE_CONTROL_QUEUE_LEN)
+    {
+        s_ctrl_queue[head & (QUICKTUNE_CONTROL_QUEUE_LEN - 1)] = (uint8_t)event;
+        QUICKTUNE_COMPILER_BARRIER();
+        s_ctrl_queue_head = head + 1;
+    }
+}
+
+/** Drain one event on the control side */
+static inline bool CtrlQueue_Pop(uint8_t* event)
+{
+    const uint32_t tail = s_ctrl_queue_tail;
+    if (tail == s_ctrl_queue_head)
+    {
+        return false;
+    }
+    *event = s_ctrl_queue[tail & (QUICKTUNE_CONTROL_QUEUE_LEN - 1)];
+    QUICKTUNE_COMPILER_BARRIER();
+    s_ctrl_queue_tail = tail + 1;
+    return true;
+}
+
+/* --------------------------------------------------------------------------
+ * HOST EVENT QUEUE (AUDIO ISR -> REGISTERED CALLBACK)
+ * -------------------------------------------------------------------------- */
+
+/** Registered host event callback (NULL when unregistered) */
+static volatile QuickTuneEventCallback s_event_cb = NULL;
+
+/** Opaque context for the host event callback */
+static void* volatile s_event_ctx = NULL;
+
+/**
+ * ISR-raised host events, packed (type << 8) | data. Same SPSC ring
+ * discipline as the control queue: the ISR is the only head writer,
+ * the control task the only tail writer. Events raised from API calls
+ * bypass the queue (see Event_Dispatch) - they already run in the
+ * control context, so a second producer never touches the head.
+ */
+static volatile uint16_t s_event_queue[QUICKTUNE_EVENT_QUEUE_LEN];
+static volatile uint32_t s_event_queue_head = 0;    /* written by the ISR */
+static volatile uint32_t s_event_queue_tail = 0;    /* written by the control task */
+
+/** Post a host event from the audio ISR (dropped if queue full or no handler) */
+static inline void Event_Post(QuickTuneEventType type, uint32_t data)
+{
+    if (s_event_cb == NULL)
+    {
+        return;
+    }
+    const uint32_t head = s_event_queue_head;
+    if ((head - s_event_queue_tail) < QUICKTUNE_EVENT_QUEUE_LEN)
+    {
+        s_event_queue[head & (QUICKTUNE_EVENT_QUEUE_LEN - 1)] =
+            (uint16_t)(((uint32_t)type << 8) | (data & 0xFFu));
+        QUICKTUNE_COMPILER_BARRIER();
+        s_event_queue_head = head + 1;
+    }
+}
+
+/** Deliver a host event from the control context (API call or control task) */
+static inline void Event_Dispatch(QuickTuneEventType type, uint32_t data)
+{
+    const QuickTuneEventCallback cb = s_event_cb;
+    if (cb != NULL)
+    {
+        cb(type, data, s_event_ctx);
+    }
+}
+
 /** Current state machine state */
 static volatile QuickTuneState s_state = QUICKTUNE_STATE_IDLE;
 
-/** Current band being measured (0-9) */
+/** Active measurement mode (parallel multi-tone or sequential stepped) */
+static QuickTuneMode s_mode = QUICKTUNE_MODE_PARALLEL;
+
+/** Current band being measured (0-9, sequential mode only) */
 static int s_current_band = 0;
 
+/** Band measurement order for sequential passes. Identity normally;
+ *  batch mode rotates it by the unit index so units sharing a time slot
+ *  always stimulate disjoint frequencies (see QuickTune_StartBatch()) */
+static uint8_t s_band_order[QUICKTUNE_NUM_BANDS] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+/** Batch mode: units calibrating concurrently (<= 1 when disabled) */
+static int s_batch_units = 0;
+
+/** Differential recalibration: bit per band to remeasure (0 = full run) */
+static uint16_t s_partial_mask = 0;
+
+#if QUICKTUNE_ADAPTIVE_ANALYSIS
+/** Samples consumed so far in the current batch time slot */
+static uint32_t s_batch_slot_counter = 0;
+
+/** Silence remaining to pad the current slot to its fixed length */
+static uint32_t s_batch_pad_remaining = 0;
+#endif
+
 /** Sample counter within current tone */
 static uint32_t s_sample_counter = 0;
 
@@ -47,6 +174,11 @@ static int s_iteration = 0;
 /** Last error code */
 static int s_last_error = 0;
 
+#if QUICKTUNE_ENABLE_PROFILING
+/** ProcessBlock cycle counters, bucketed by state machine state */
+static QTProf_Counter s_prof_by_state[QUICKTUNE_NUM_STATES];
+#endif
+
 /* --------------------------------------------------------------------------
  * TONE GENERATOR STATE (Recursive Oscillator)
  * -------------------------------------------------------------------------- */
@@ -63,22 +195,118 @@ static float s_osc_coeff = 0.0f;
 /** Current tone amplitude (with fade) */
 static float s_tone_amplitude = 0.0f;
 
+/* --------------------------------------------------------------------------
+ * TONE BANK STATE (Parallel Mode - 10 Concurrent Oscillators)
+ * -------------------------------------------------------------------------- */
+
+/** Oscillator bank state: y[n-1] per band */
+QUICKTUNE_FAST_DATA static float s_osc_bank_y1[QUICKTUNE_NUM_BANDS];
+
+/** Oscillator bank state: y[n-2] per band */
+QUICKTUNE_FAST_DATA static float s_osc_bank_y2[QUICKTUNE_NUM_BANDS];
+
+/** Oscillator bank coefficients: 2*cos(w0) per band */
+QUICKTUNE_FAST_DATA static float s_osc_bank_coeffs[QUICKTUNE_NUM_BANDS];
+
 /* --------------------------------------------------------------------------
  * GOERTZEL FILTER STATE
  * -------------------------------------------------------------------------- */
 
+/**
+ * Accumulator type for the sequential tone detector. f64 keeps the
+ * finalize cancellation exact over the 4800-sample window; softfloat
+ * cost on the M33 is acceptable for one bin during calibration only
+ * (see quicktune_config.h).
+ */
+#if QUICKTUNE_GOERTZEL_F64
+typedef double qt_goertzel_acc_t;
+#else
+typedef float qt_goertzel_acc_t;
+#endif
+
 /** Goertzel state: s[n-1] */
-static float s_goertzel_s1 = 0.0f;
+static qt_goertzel_acc_t s_goertzel_s1 = 0.0f;
 
 /** Goertzel state: s[n-2] */
-static float s_goertzel_s2 = 0.0f;
+static qt_goertzel_acc_t s_goertzel_s2 = 0.0f;
 
 /** Goertzel coefficient: 2*cos(2*pi*k/N) */
 static float s_goertzel_coeff = 0.0f;
 
-/** Precomputed Goertzel coefficients for all bands */
+/** Precomputed Goertzel coefficients for all bands (sequential window) */
 static float s_goertzel_coeffs[QUICKTUNE_NUM_BANDS];
 
+/* --------------------------------------------------------------------------
+ * GOERTZEL BANK STATE (Parallel Mode - 10 Concurrent Detectors)
+ * -------------------------------------------------------------------------- */
+
+/** Goertzel bank state: s[n-1] per band */
+QUICKTUNE_FAST_DATA static float s_goertzel_bank_s1[QUICKTUNE_NUM_BANDS];
+
+/** Goertzel bank state: s[n-2] per band */
+QUICKTUNE_FAST_DATA static float s_goertzel_bank_s2[QUICKTUNE_NUM_BANDS];
+
+/** Goertzel bank coefficients (parallel window, or per-band sweep windows) */
+QUICKTUNE_FAST_DATA static float s_goertzel_bank_coeffs[QUICKTUNE_NUM_BANDS];
+
+/* --------------------------------------------------------------------------
+ * SWEEP ENGINE STATE (Sweep Mode)
+ * -------------------------------------------------------------------------- */
+
+/** Sweep oscillator phase (rad) */
+static float s_sweep_phase = 0.0f;
+
+/** Sweep instantaneous frequency (Hz) */
+static float s_sweep_freq = 0.0f;
+
+/** Per-sample frequency growth factor for the log sweep */
+static float s_sweep_growth = 1.0f;
+
+/** First sample index of each band's analysis window */
+static uint32_t s_sweep_band_start[QUICKTUNE_NUM_BANDS];
+
+/** One-past-last sample index of each band's analysis window */
+static uint32_t s_sweep_band_end[QUICKTUNE_NUM_BANDS];
+
+/** Reference Goertzel state on the generated stimulus: s[n-1] per band */
+static float s_sweep_ref_s1[QUICKTUNE_NUM_BANDS];
+
+/** Reference Goertzel state on the generated stimulus: s[n-2] per band */
+static float s_sweep_ref_s2[QUICKTUNE_NUM_BANDS];
+
+/** Band currently being swept through (next to finalize) */
+static int s_sweep_band = 0;
+
+/* --------------------------------------------------------------------------
+ * BACKGROUND MONITOR STATE
+ * -------------------------------------------------------------------------- */
+
+/** Monitoring enabled (set by QuickTune_StartMonitoring) */
+static volatile bool s_monitor_enabled = false;
+
+/** Band currently being monitored (rotates every window) */
+static int s_monitor_band = 0;
+
+/** Per-band monitor window lengths (whole cycles of fc, samples) */
+static uint32_t s_monitor_windows[QUICKTUNE_NUM_BANDS];
+
+/** Per-band Goertzel coefficients for the monitor windows */
+static float s_monitor_coeffs[QUICKTUNE_NUM_BANDS];
+
+/** Sample counter within the current monitor window */
+static uint32_t s_monitor_counter = 0;
+
+/** Mic detector state: s[n-1], s[n-2] */
+static float s_monitor_mic_s1 = 0.0f;
+static float s_monitor_mic_s2 = 0.0f;
+
+/** Speaker reference detector state: s[n-1], s[n-2] */
+static float s_monitor_spk_s1 = 0.0f;
+static float s_monitor_spk_s2 = 0.0f;
+
+/** Monitoring status (estimates, reference, drift) */
+static QuickTuneMonitorStatus s_monitor_status;
+
 /* --------------------------------------------------------------------------
  * MEASUREMENT RESULTS
  * -------------------------------------------------------------------------- */
@@ -92,6 +320,146 @@ static float s_correction_gains[QUICKTUNE_NUM_BANDS];
 /** Cumulative gains across iterations (dB) */
 static float s_cumulative_gains[QUICKTUNE_NUM_BANDS];
 
+/* --------------------------------------------------------------------------
+ * MULTI-POSITION CALIBRATION (SPATIAL AVERAGING)
+ * -------------------------------------------------------------------------- */
+
+/** Positions requested for this calibration (<= 1: single-position) */
+static int s_mp_total = 0;
+
+/** Positions measured and merged so far */
+static int s_mp_done = 0;
+
+/** Per-position weights */
+static float s_mp_weights[QUICKTUNE_MAX_POSITIONS];
+
+/** Sum of merged weights */
+static float s_mp_weight_sum = 0.0f;
+
+/** Weighted sum of per-position band power (linear) - the O(bands) merge */
+static float s_mp_power_sum[QUICKTUNE_NUM_BANDS];
+
+#if QUICKTUNE_ADAPTIVE_ANALYSIS
+/* --------------------------------------------------------------------------
+ * ADAPTIVE MEASUREMENT CONTROLLER (SEQUENTIAL MODE)
+ * -------------------------------------------------------------------------- */
+
+/** Per-band diagnostics from the most recent adaptive measurements */
+static QuickTuneMeasureDiag s_measure_diag;
+
+/** Diagnostics valid (at least one band measured adaptively) */
+static bool s_measure_diag_valid = false;
+
+/** Chunk length for the current band (whole cycles of fc; low-rate
+ *  samples when the decimated path is active) */
+static uint32_t s_chunk_samples = 0;
+
+/** Sample counter within the current chunk */
+static uint32_t s_chunk_counter = 0;
+
+/** Completed chunks in the current phase */
+static int s_chunk_count = 0;
+
+/** Previous chunk level (dB) for the stabilization test */
+static float s_chunk_prev_db = 0.0f;
+
+/** Accumulated noise power (linear) across noise estimate chunks */
+static float s_noise_power_sum = 0.0f;
+
+/** True while the tone is muted for the noise floor estimate */
+static bool s_noise_phase = false;
+
+/** Tone end (samples): 0 while analysis is open-ended, set to begin fade-out */
+static uint32_t s_tone_total = 0;
+
+#if QUICKTUNE_HARMONIC_CAPTURE
+/* --------------------------------------------------------------------------
+ * HARMONIC CAPTURE STATE (RUB & BUZZ SCREENING)
+ * -------------------------------------------------------------------------- */
+
+/** Exact-bin fundamental Goertzel coefficient (THD reference) */
+static float s_h1_coeff = 0.0f;
+
+/** Exact-bin fundamental Goertzel state: s[n-1], s[n-2] */
+static float s_h1_s1 = 0.0f;
+static float s_h1_s2 = 0.0f;
+
+/** 2nd harmonic Goertzel coefficient for the current band */
+static float s_h2_coeff = 0.0f;
+
+/** 2nd harmonic Goertzel state: s[n-1], s[n-2] */
+static float s_h2_s1 = 0.0f;
+static float s_h2_s2 = 0.0f;
+
+/** 3rd harmonic Goertzel coefficient for the current band */
+static float s_h3_coeff = 0.0f;
+
+/** 3rd harmonic Goertzel state: s[n-1], s[n-2] */
+static float s_h3_s1 = 0.0f;
+static float s_h3_s2 = 0.0f;
+
+/** Per-band harmonic levels from the most recent sequential pass */
+static QuickTuneHarmonicLevels s_harmonic_levels;
+#endif
+
+#if QUICKTUNE_DECIMATED_ANALYSIS
+/* --------------------------------------------------------------------------
+ * DECIMATED ANALYSIS STATE (SUB-100 HZ BANDS)
+ * -------------------------------------------------------------------------- */
+
+/** Anti-alias decimator (CMSIS FIR, 48 kHz -> 3 kHz) */
+static arm_fir_decimate_instance_f32 s_decim_inst;
+
+/** FIR decimator state (numTaps + blockSize - 1 per CMSIS) */
+QUICKTUNE_FAST_DATA static float s_decim_fir_state[QUICKTUNE_DECIM_NUM_TAPS +
+                                                   QUICKTUNE_DECIM_FACTOR - 1];
+
+/** Input staging: one decimator input frame */
+QUICKTUNE_FAST_DATA static float s_decim_inbuf[QUICKTUNE_DECIM_FACTOR];
+
+/** Samples staged in s_decim_inbuf */
+static int s_decim_fill = 0;
+
+/** Current band is measured at the decimated rate */
+static bool s_decim_active = false;
+#endif
+#endif
+
+#if QUICKTUNE_DIAG_CAPTURE
+/* --------------------------------------------------------------------------
+ * DIAGNOSTIC SPECTRUM CAPTURE STATE
+ * -------------------------------------------------------------------------- */
+
+/** Goertzel coefficients for the diagnostic bins (copied to RAM at init) */
+QUICKTUNE_FAST_DATA static float s_diag_coeffs[QUICKTUNE_DIAG_BINS];
+
+/** Goertzel bank delay states, struct-of-arrays */
+QUICKTUNE_FAST_DATA static float s_diag_s1[QUICKTUNE_DIAG_BINS];
+QUICKTUNE_FAST_DATA static float s_diag_s2[QUICKTUNE_DIAG_BINS];
+
+/** Samples accumulated into the current capture window */
+static uint32_t s_diag_window_counter = 0;
+
+/** Next window sequence number (advances even for dropped windows) */
+static uint16_t s_diag_seq = 0;
+
+/** Window snapshot handed from the ISR to the control task. The valid
+ *  flag has one writer per transition: the ISR sets it after filling
+ *  the snapshot, the control task clears it after consuming - same
+ *  single-core publish pattern as the control event queue. */
+static float s_diag_snap_s1[QUICKTUNE_DIAG_BINS];
+static float s_diag_snap_s2[QUICKTUNE_DIAG_BINS];
+static uint8_t s_diag_snap_band = 0;
+static uint16_t s_diag_snap_seq = 0;
+static volatile bool s_diag_snap_valid = false;
+
+/** Stream ring: byte i of the stream lives at i % QUICKTUNE_DIAG_RING_BYTES */
+static uint8_t s_diag_ring[QUICKTUNE_DIAG_RING_BYTES];
+
+/** Total stream bytes produced (monotonic within one calibration) */
+static uint32_t s_diag_total = 0;
+#endif
+
 /* ============================================================================
  * PRIVATE FUNCTIONS - TONE GENERATOR
  * ============================================================================ */
@@ -128,46 +496,204 @@ static void ToneGenerator_Init(float frequency)
 }
 
 /**
- * @brief Generate one sample of sine tone
+ * @brief Compute the linear fade envelope for one block segment
  *
- * Recursive oscillator: y[n] = 2*cos(w0)*y[n-1] - y[n-2]
- * CPU: ~3 cycles per sample
+ * The fade in/out envelope is linear, so over a segment that does not
+ * cross a fade boundary it reduces to a start value plus a per-sample
+ * increment - a precomputed ramp instead of per-sample branches.
+ * Callers must split blocks at fade boundaries (see SegmentLimit()).
  *
- * @param sample_index Current sample index (for fade in/out)
- * @return Tone sample
+ * @param sample_index First sample index of the segment
+ * @param total_samples Total tone duration (for fade-out position)
+ * @param amp0 Output: envelope value at segment start
+ * @param dAmp Output: per-sample envelope increment
  */
-static inline float ToneGenerator_GetSample(uint32_t sample_index)
+static inline void ToneEnvelope_GetRamp(uint32_t sample_index, uint32_t total_samples,
+                                        float* amp0, float* dAmp)
 {
-    // Recursive oscillator update
-    const float y0 = s_osc_coeff * s_osc_y1 - s_osc_y2;
-    s_osc_y2 = s_osc_y1;
-    s_osc_y1 = y0;
-
-    // Apply fade in/out to reduce clicks
-    float amplitude = s_tone_amplitude;
+    const float step = s_tone_amplitude / (float)QUICKTUNE_FADE_SAMPLES;
 
-    // Fade in (first QUICKTUNE_FADE_SAMPLES)
     if (sample_index < QUICKTUNE_FADE_SAMPLES)
     {
-        amplitude *= (float)sample_index / QUICKTUNE_FADE_SAMPLES;
+        // Fade in
+        *amp0 = step * (float)sample_index;
+        *dAmp = step;
+    }
+    else if (sample_index >= total_samples - QUICKTUNE_FADE_SAMPLES)
+    {
+        // Fade out
+        *amp0 = step * (float)(total_samples - sample_index);
+        *dAmp = -step;
+    }
+    else
+    {
+        // Steady state
+        *amp0 = s_tone_amplitude;
+        *dAmp = 0.0f;
+    }
+}
+
+/**
+ * @brief Generate a block of sine tone samples
+ *
+ * Recursive oscillator: y[n] = 2*cos(w0)*y[n-1] - y[n-2], unrolled 4x
+ * with the fade envelope precomputed as a ramp. The segment must not
+ * cross a fade boundary (caller splits via SegmentLimit()).
+ *
+ * CPU: ~3 cycles per sample plus ramp multiply.
+ *
+ * @param out Output buffer
+ * @param n Number of samples to generate
+ * @param total_samples Total tone duration (for fade-out position)
+ */
+QUICKTUNE_FAST_CODE static void ToneGenerator_FillBlock(float* out, int n, uint32_t total_samples)
+{
+    float amp, dAmp;
+    ToneEnvelope_GetRamp(s_sample_counter, total_samples, &amp, &dAmp);
+
+    const float coeff = s_osc_coeff;
+    float y1 = s_osc_y1;
+    float y2 = s_osc_y2;
+
+    int i = 0;
+    for (; i <= n - 4; i += 4)
+    {
+        const float a = coeff * y1 - y2;
+        const float b = coeff * a - y1;
+        const float c = coeff * b - a;
+        const float d = coeff * c - b;
+        out[i]     = a * amp;
+        out[i + 1] = b * (amp + dAmp);
+        out[i + 2] = c * (amp + 2.0f * dAmp);
+        out[i + 3] = d * (amp + 3.0f * dAmp);
+        amp += 4.0f * dAmp;
+        y2 = c;
+        y1 = d;
+    }
+    for (; i < n; i++)
+    {
+        const float y0 = coeff * y1 - y2;
+        y2 = y1;
+        y1 = y0;
+        out[i] = y0 * amp;
+        amp += dAmp;
+    }
+
+    s_osc_y1 = y1;
+    s_osc_y2 = y2;
+}
+
+/* ============================================================================
+ * PRIVATE FUNCTIONS - TONE BANK (PARALLEL MODE)
+ * ============================================================================ */
+
+/**
+ * @brief Initialize oscillator bank for the composite multi-tone stimulus
+ *
+ * One recursive oscillator per band, seeded with Newman phases
+ * (phi_k = pi*(k-1)^2/K) so the 10-tone sum has a crest factor near
+ * sqrt(2) instead of the worst-case K when all tones align.
+ */
+static void ToneBank_Init(void)
+{
+    for (int band = 0; band < QUICKTUNE_NUM_BANDS; band++)
+    {
+        const float frequency = QUICKTUNE_BAND_FREQUENCIES[band];
+        const float w0 = 2.0f * M_PI * frequency / QUICKTUNE_SAMPLE_RATE;
+
+        // Newman phase for crest factor optimization
+        const float phi = (float)M_PI * (float)(band * band) / (float)QUICKTUNE_NUM_BANDS;
+
+        // Compute coefficient: 2*cos(w0)
+        #ifdef ARM_MATH_CM33
+        s_osc_bank_coeffs[band] = 2.0f * arm_cos_f32(w0);
+        #else
+        s_osc_bank_coeffs[band] = 2.0f * cosf(w0);
+        #endif
+
+        // Seed recursion so y[n] = sin(w0*n + phi):
+        // y[-1] = sin(phi - w0), y[-2] = sin(phi - 2*w0)
+        #ifdef ARM_MATH_CM33
+        s_osc_bank_y1[band] = arm_sin_f32(phi - w0);
+        s_osc_bank_y2[band] = arm_sin_f32(phi - 2.0f * w0);
+        #else
+        s_osc_bank_y1[band] = sinf(phi - w0);
+        s_osc_bank_y2[band] = sinf(phi - 2.0f * w0);
+        #endif
     }
-    // Fade out (last QUICKTUNE_FADE_SAMPLES)
-    else if (sample_index >= QUICKTUNE_TONE_TOTAL_SAMPLES - QUICKTUNE_FADE_SAMPLES)
+
+    s_tone_amplitude = QUICKTUNE_PARALLEL_TONE_AMPLITUDE;
+}
+
+/**
+ * @brief Generate a block of the composite multi-tone stimulus
+ *
+ * Band-outer / sample-inner: each oscillator's recurrence runs over the
+ * whole block before moving to the next band, keeping the loop body
+ * free of cross-band dependencies for pipelining (and future MVE).
+ * The fade envelope is applied as a precomputed ramp in a final pass
+ * over the block, which maps directly onto arm_mult/arm_scale ops.
+ *
+ * CPU: ~3 cycles per band per sample plus one envelope pass.
+ *
+ * @param out Output buffer
+ * @param n Number of samples to generate
+ */
+QUICKTUNE_FAST_CODE static void ToneBank_FillBlock(float* out, int n)
+{
+    for (int band = 0; band < QUICKTUNE_NUM_BANDS; band++)
     {
-        const uint32_t fade_index = QUICKTUNE_TONE_TOTAL_SAMPLES - sample_index;
-        amplitude *= (float)fade_index / QUICKTUNE_FADE_SAMPLES;
+        const float coeff = s_osc_bank_coeffs[band];
+        float y1 = s_osc_bank_y1[band];
+        float y2 = s_osc_bank_y2[band];
+
+        if (band == 0)
+        {
+            for (int i = 0; i < n; i++)
+            {
+                const float y0 = coeff * y1 - y2;
+                y2 = y1;
+                y1 = y0;
+                out[i] = y0;
+            }
+        }
+        else
+        {
+            for (int i = 0; i < n; i++)
+            {
+                const float y0 = coeff * y1 - y2;
+                y2 = y1;
+                y1 = y0;
+                out[i] += y0;
+            }
+        }
+
+        s_osc_bank_y1[band] = y1;
+        s_osc_bank_y2[band] = y2;
     }
 
-    return y0 * amplitude;
+    // Apply fade envelope as a ramp over the composite
+    float amp, dAmp;
+    ToneEnvelope_GetRamp(s_sample_counter, QUICKTUNE_PARALLEL_TOTAL_SAMPLES, &amp, &dAmp);
+
+    for (int i = 0; i < n; i++)
+    {
+        out[i] *= amp;
+        amp += dAmp;
+    }
 }
 
 /* ============================================================================
  * PRIVATE FUNCTIONS - GOERTZEL FILTER
  * ============================================================================ */
 
+#if !QUICKTUNE_ADAPTIVE_ANALYSIS
 /**
  * @brief Initialize Goertzel filter for target frequency
  *
+ * With adaptive analysis enabled the shared detector is configured
+ * straight from the constexpr chunk tables instead.
+ *
  * @param frequency Target frequency (Hz)
  * @param num_samples Number of samples in analysis window
  */
@@ -188,20 +714,43 @@ static void Goertzel_Init(float frequency, int num_samples)
     s_goertzel_s1 = 0.0f;
     s_goertzel_s2 = 0.0f;
 }
+#endif /* !QUICKTUNE_ADAPTIVE_ANALYSIS */
 
 /**
- * @brief Process one sample through Goertzel filter
+ * @brief Process a block of samples through the Goertzel filter
  *
- * Goertzel iteration: s0 = coeff*s1 - s2 + x[n]
- * CPU: ~4 cycles per sample
+ * Goertzel iteration: s0 = coeff*s1 - s2 + x[n], unrolled 4x with the
+ * state kept in locals across the block.
+ * CPU: ~4 cycles per sample.
  *
- * @param sample Input sample
+ * @param x Input buffer
+ * @param n Number of samples to process
  */
-static inline void Goertzel_ProcessSample(float sample)
+QUICKTUNE_FAST_CODE static void Goertzel_ProcessBlock(const float* x, int n)
 {
-    const float s0 = s_goertzel_coeff * s_goertzel_s1 - s_goertzel_s2 + sample;
-    s_goertzel_s2 = s_goertzel_s1;
-    s_goertzel_s1 = s0;
+    const qt_goertzel_acc_t coeff = s_goertzel_coeff;
+    qt_goertzel_acc_t s1 = s_goertzel_s1;
+    qt_goertzel_acc_t s2 = s_goertzel_s2;
+
+    int i = 0;
+    for (; i <= n - 4; i += 4)
+    {
+        const qt_goertzel_acc_t a = coeff * s1 - s2 + x[i];
+        const qt_goertzel_acc_t b = coeff * a - s1 + x[i + 1];
+        const qt_goertzel_acc_t c = coeff * b - a + x[i + 2];
+        const qt_goertzel_acc_t d = coeff * c - b + x[i + 3];
+        s2 = c;
+        s1 = d;
+    }
+    for (; i < n; i++)
+    {
+        const qt_goertzel_acc_t s0 = coeff * s1 - s2 + x[i];
+        s2 = s1;
+        s1 = s0;
+    }
+
+    s_goertzel_s1 = s1;
+    s_goertzel_s2 = s2;
 }
 
 /**
@@ -212,15 +761,28 @@ static inline void Goertzel_ProcessSample(float sample)
  * @param num_samples Number of samples processed
  * @return Power at target frequency
  */
-static float Goertzel_GetPower(int num_samples)
+static float Goertzel_FinalizeMagnitude(qt_goertzel_acc_t s1, qt_goertzel_acc_t s2,
+                                        float coeff, int num_samples)
 {
-    // Final power computation: power = s1^2 + s2^2 - coeff*s1*s2
-    const float power = s_goertzel_s1 * s_goertzel_s1 +
-                        s_goertzel_s2 * s_goertzel_s2 -
-                        s_goertzel_coeff * s_goertzel_s1 * s_goertzel_s2;
+    // Final power computation: power = s1^2 + s2^2 - coeff*s1*s2.
+    // Always in f64: the subtraction cancels almost all of s1^2 + s2^2
+    // for a strong in-band signal, and the f32 bank states promote for
+    // free - only the recurrence itself is precision-configurable.
+    const double power = (double)s1 * s1 + (double)s2 * s2
+                       - (double)coeff * s1 * s2;
 
     // Normalize: magnitude = sqrt(2 * power) / N
-    const float magnitude = sqrtf(2.0f * power) / num_samples;
+    if (power <= 0.0)
+    {
+        return 0.0f;
+    }
+    return (float)(sqrt(2.0 * power) / num_samples);
+}
+
+static float Goertzel_FinalizeLevel(qt_goertzel_acc_t s1, qt_goertzel_acc_t s2,
+                                    float coeff, int num_samples)
+{
+    const float magnitude = Goertzel_FinalizeMagnitude(s1, s2, coeff, num_samples);
 
     // Convert to dB relative to unit amplitude
     float level_db = -120.0f;  // Floor
@@ -232,59 +794,1122 @@ static float Goertzel_GetPower(int num_samples)
     return level_db;
 }
 
-/* ============================================================================
- * PRIVATE FUNCTIONS - STATE MACHINE
- * ============================================================================ */
+#if !QUICKTUNE_ADAPTIVE_ANALYSIS
+static float Goertzel_GetPower(int num_samples)
+{
+    return Goertzel_FinalizeLevel(s_goertzel_s1, s_goertzel_s2, s_goertzel_coeff, num_samples);
+}
+#endif
 
+#if QUICKTUNE_ADAPTIVE_ANALYSIS && QUICKTUNE_HARMONIC_CAPTURE
 /**
- * @brief Start measurement of next band
+ * @brief Run the exact-bin f/2f/3f harmonic detectors over a block
+ *
+ * Same iteration as Goertzel_ProcessBlock with the three detector
+ * states interleaved in locals; runs on the mic alongside the level
+ * detector during sequential stimulus chunks. CPU: ~12 cycles per
+ * sample, sequential measurement only.
+ *
+ * @param x Input buffer
+ * @param n Number of samples to process
  */
-static void StartBandMeasurement(void)
+QUICKTUNE_FAST_CODE static void Goertzel_ProcessBlockHarmonics(const float* x, int n)
 {
-    if (s_current_band >= QUICKTUNE_NUM_BANDS)
+    const float c1 = s_h1_coeff;
+    const float c2 = s_h2_coeff;
+    const float c3 = s_h3_coeff;
+    float f1 = s_h1_s1;
+    float f2 = s_h1_s2;
+    float a1 = s_h2_s1;
+    float a2 = s_h2_s2;
+    float b1 = s_h3_s1;
+    float b2 = s_h3_s2;
+
+    for (int i = 0; i < n; i++)
     {
-        // All bands measured, move to computing state
-        s_state = QUICKTUNE_STATE_COMPUTING;
-        return;
+        const float xi = x[i];
+        const float f0 = c1 * f1 - f2 + xi;
+        const float a0 = c2 * a1 - a2 + xi;
+        const float b0 = c3 * b1 - b2 + xi;
+        f2 = f1;
+        f1 = f0;
+        a2 = a1;
+        a1 = a0;
+        b2 = b1;
+        b1 = b0;
     }
 
-    const float frequency = QUICKTUNE_BAND_FREQUENCIES[s_current_band];
-
-    // Initialize tone generator
-    ToneGenerator_Init(frequency);
-
-    // Initialize Goertzel filter
-    Goertzel_Init(frequency, QUICKTUNE_TONE_ANALYSIS_SAMPLES);
-
-    // Reset sample counter
-    s_sample_counter = 0;
+    s_h1_s1 = f1;
+    s_h1_s2 = f2;
+    s_h2_s1 = a1;
+    s_h2_s2 = a2;
+    s_h3_s1 = b1;
+    s_h3_s2 = b2;
 }
+#endif
 
+#if QUICKTUNE_ADAPTIVE_ANALYSIS && QUICKTUNE_DECIMATED_ANALYSIS
 /**
- * @brief Compute correction gains from measured levels
+ * @brief Feed mic samples through the decimator to the low-rate detectors
+ *
+ * Stages full-rate samples into one decimation frame; each completed
+ * frame yields one anti-aliased low-rate sample, which advances the
+ * level detector (and the harmonic detectors during stimulus chunks)
+ * and counts one low-rate sample toward the current chunk. With analyze
+ * false the FIR is only kept primed (fade-in: the delay line keeps
+ * tracking the mic so the first analysis frame is not a discontinuity).
+ *
+ * @param x Input buffer (full rate)
+ * @param n Number of full-rate samples
+ * @param analyze Advance the detectors and the chunk counter
+ * @param harmonics Also run the harmonic detectors (stimulus chunks)
  */
-static void ComputeCorrectionGains(void)
+QUICKTUNE_FAST_CODE static void Decim_ProcessBlock(const float* x, int n,
+                                                   bool analyze, bool harmonics)
 {
-    for (int band = 0; band < QUICKTUNE_NUM_BANDS; band++)
+    for (int i = 0; i < n; i++)
     {
-        // Target is 0 dB (flat response)
-        // Correction gain = target - measured
-        float gain = -s_measured_levels[band];
+        s_decim_inbuf[s_decim_fill++] = x[i];
+        if (s_decim_fill < QUICKTUNE_DECIM_FACTOR)
+        {
+            continue;
+        }
+        s_decim_fill = 0;
 
-        // Clip to ±12 dB
-        if (gain > QUICKTUNE_MAX_GAIN_DB)
-            gain = QUICKTUNE_MAX_GAIN_DB;
-        if (gain < QUICKTUNE_MIN_GAIN_DB)
-            gain = QUICKTUNE_MIN_GAIN_DB;
+        float y;
+        arm_fir_decimate_f32(&s_decim_inst, s_decim_inbuf, &y,
+                             QUICKTUNE_DECIM_FACTOR);
+        if (!analyze)
+        {
+            continue;
+        }
 
-        s_correction_gains[band] = gain;
+        const float s0 = s_goertzel_coeff * s_goertzel_s1 - s_goertzel_s2 + y;
+        s_goertzel_s2 = s_goertzel_s1;
+        s_goertzel_s1 = s0;
 
-        // Update cumulative gains (for iterative refinement)
-        if (s_iteration == 0)
+        #if QUICKTUNE_HARMONIC_CAPTURE
+        if (harmonics)
         {
-            s_cumulative_gains[band] = gain;
+            Goertzel_ProcessBlockHarmonics(&y, 1);
         }
-        else
+        #else
+        (void)harmonics;
+        #endif
+
+        s_chunk_counter++;
+    }
+}
+#endif
+
+/* ============================================================================
+ * PRIVATE FUNCTIONS - GOERTZEL BANK (PARALLEL MODE)
+ * ============================================================================ */
+
+/**
+ * @brief Initialize Goertzel detector bank for all bands
+ *
+ * @param num_samples Number of samples in analysis window
+ */
+static void GoertzelBank_Init(int num_samples)
+{
+    for (int band = 0; band < QUICKTUNE_NUM_BANDS; band++)
+    {
+        const float frequency = QUICKTUNE_BAND_FREQUENCIES[band];
+
+        // Compute bin index: k = round(N * f / fs)
+        const float k = (float)num_samples * frequency / QUICKTUNE_SAMPLE_RATE + 0.5f;
+        const float w = (2.0f * M_PI * k) / num_samples;
+
+        #ifdef ARM_MATH_CM33
+        s_goertzel_bank_coeffs[band] = 2.0f * arm_cos_f32(w);
+        #else
+        s_goertzel_bank_coeffs[band] = 2.0f * cosf(w);
+        #endif
+
+        s_goertzel_bank_s1[band] = 0.0f;
+        s_goertzel_bank_s2[band] = 0.0f;
+    }
+}
+
+/**
+ * @brief Process a block of samples through all 10 Goertzel detectors
+ *
+ * Band-outer / sample-inner: each detector runs its recurrence over the
+ * whole block with state in locals, so the inner loop carries only the
+ * per-band dependency chain and the input block stays hot in cache
+ * across all 10 passes.
+ *
+ * CPU: ~4 cycles per band per sample.
+ *
+ * @param x Input buffer
+ * @param n Number of samples to process
+ */
+QUICKTUNE_FAST_CODE static void GoertzelBank_ProcessBlock(const float* x, int n)
+{
+    for (int band = 0; band < QUICKTUNE_NUM_BANDS; band++)
+    {
+        const float coeff = s_goertzel_bank_coeffs[band];
+        float s1 = s_goertzel_bank_s1[band];
+        float s2 = s_goertzel_bank_s2[band];
+
+        int i = 0;
+        for (; i <= n - 4; i += 4)
+        {
+            const float a = coeff * s1 - s2 + x[i];
+            const float b = coeff * a - s1 + x[i + 1];
+            const float c = coeff * b - a + x[i + 2];
+            const float d = coeff * c - b + x[i + 3];
+            s2 = c;
+            s1 = d;
+        }
+        for (; i < n; i++)
+        {
+            const float s0 = coeff * s1 - s2 + x[i];
+            s2 = s1;
+            s1 = s0;
+        }
+
+        s_goertzel_bank_s1[band] = s1;
+        s_goertzel_bank_s2[band] = s2;
+    }
+}
+
+/**
+ * @brief Compute final level for one bank detector
+ *
+ * @param band Band index (0-9)
+ * @param num_samples Number of samples processed
+ * @return Level at target frequency (dB)
+ */
+static float GoertzelBank_GetLevel(int band, int num_samples)
+{
+    return Goertzel_FinalizeLevel(s_goertzel_bank_s1[band],
+                                  s_goertzel_bank_s2[band],
+                                  s_goertzel_bank_coeffs[band],
+                                  num_samples);
+}
+
+#if QUICKTUNE_DIAG_CAPTURE
+/* ============================================================================
+ * PRIVATE FUNCTIONS - DIAGNOSTIC SPECTRUM CAPTURE
+ * ============================================================================ */
+
+static uint32_t Preset_Crc32(const uint8_t* data, uint32_t length);
+
+/** Reset the capture bank and stream (each calibration start) */
+static void DiagCapture_Reset(void)
+{
+    memset(s_diag_s1, 0, sizeof(s_diag_s1));
+    memset(s_diag_s2, 0, sizeof(s_diag_s2));
+    s_diag_window_counter = 0;
+    s_diag_seq = 0;
+    s_diag_snap_valid = false;
+    s_diag_total = 0;
+}
+
+/**
+ * @brief Run the diagnostic bin bank over a mic block
+ *
+ * Bin-outer / sample-inner over window-bounded segments, same kernel
+ * shape as GoertzelBank_ProcessBlock: ~4 cycles per bin per sample with
+ * the delay states in locals. 64 bins cost roughly 5% of the sample
+ * budget, MEASURING only. At each window boundary the delay states are
+ * snapshotted for the control task (or dropped whole if the previous
+ * snapshot is still pending; the sequence number advances either way so
+ * the host sees the gap) and the bank restarts.
+ *
+ * @param x Mic input
+ * @param n Number of samples to process
+ */
+QUICKTUNE_FAST_CODE static void DiagCapture_ProcessBlock(const float* x, int n)
+{
+    int idx = 0;
+
+    while (idx < n)
+    {
+        const uint32_t remaining = QUICKTUNE_DIAG_WINDOW_SAMPLES
+                                   - s_diag_window_counter;
+        int seg = n - idx;
+        if ((uint32_t)seg > remaining)
+        {
+            seg = (int)remaining;
+        }
+
+        for (int bin = 0; bin < QUICKTUNE_DIAG_BINS; bin++)
+        {
+            const float coeff = s_diag_coeffs[bin];
+            float s1 = s_diag_s1[bin];
+            float s2 = s_diag_s2[bin];
+
+            int i = idx;
+            for (; i <= idx + seg - 4; i += 4)
+            {
+                const float a = coeff * s1 - s2 + x[i];
+                const float b = coeff * a - s1 + x[i + 1];
+                const float c = coeff * b - a + x[i + 2];
+                const float d = coeff * c - b + x[i + 3];
+                s2 = c;
+                s1 = d;
+            }
+            for (; i < idx + seg; i++)
+            {
+                const float s0 = coeff * s1 - s2 + x[i];
+                s2 = s1;
+                s1 = s0;
+            }
+
+            s_diag_s1[bin] = s1;
+            s_diag_s2[bin] = s2;
+        }
+
+        idx += seg;
+        s_diag_window_counter += (uint32_t)seg;
+
+        if (s_diag_window_counter >= QUICKTUNE_DIAG_WINDOW_SAMPLES)
+        {
+            s_diag_window_counter = 0;
+            const uint16_t seq = s_diag_seq++;
+
+            if (!s_diag_snap_valid)
+            {
+                memcpy(s_diag_snap_s1, s_diag_s1, sizeof(s_diag_snap_s1));
+                memcpy(s_diag_snap_s2, s_diag_s2, sizeof(s_diag_snap_s2));
+                uint8_t band = QUICKTUNE_DIAG_BAND_NONE;
+                if (s_mode == QUICKTUNE_MODE_SEQUENTIAL &&
+                    s_current_band < QUICKTUNE_NUM_BANDS)
+                {
+                    band = s_band_order[s_current_band];
+                    #if QUICKTUNE_ADAPTIVE_ANALYSIS
+                    // Silence at the window end: noise estimate or
+                    // batch slot padding, no band being stimulated
+                    if (s_noise_phase || s_batch_pad_remaining > 0)
+                    {
+                        band = QUICKTUNE_DIAG_BAND_NONE;
+                    }
+                    #endif
+                }
+                s_diag_snap_band = band;
+                s_diag_snap_seq = seq;
+                QUICKTUNE_COMPILER_BARRIER();
+                s_diag_snap_valid = true;
+                CtrlQueue_Push(QT_CTRL_EVENT_DIAG_WINDOW);
+            }
+
+            memset(s_diag_s1, 0, sizeof(s_diag_s1));
+            memset(s_diag_s2, 0, sizeof(s_diag_s2));
+        }
+    }
+}
+
+/**
+ * @brief Finalize a snapshotted window into one stream record
+ *
+ * Control-task side: per-bin magnitude finalize, dB quantization to 0.5
+ * dB steps and CRC - none of it touches the ISR budget. The record is
+ * appended at its absolute stream offset; the ring silently overwrites
+ * the oldest bytes once QUICKTUNE_DIAG_RING_BYTES is exceeded.
+ */
+static void DiagCapture_EmitRecord(void)
+{
+    if (!s_diag_snap_valid)
+    {
+        return;
+    }
+
+    QuickTuneDiagRecord rec;
+    rec.sync = QUICKTUNE_DIAG_SYNC;
+    rec.band = s_diag_snap_band;
+    rec.seq = s_diag_snap_seq;
+
+    for (int bin = 0; bin < QUICKTUNE_DIAG_BINS; bin++)
+    {
+        const float db = Goertzel_FinalizeLevel(s_diag_snap_s1[bin],
+                                                s_diag_snap_s2[bin],
+                                                s_diag_coeffs[bin],
+                                                QUICKTUNE_DIAG_WINDOW_SAMPLES);
+
+        // Quantize: 0.5 dB steps from the -120 dB floor
+        int q = (int)((db + 120.0f) * 2.0f + 0.5f);
+        if (q < 0) { q = 0; }
+        if (q > 255) { q = 255; }
+        rec.bins[bin] = (uint8_t)q;
+    }
+
+    rec.crc = Preset_Crc32((const uint8_t*)&rec,
+                           offsetof(QuickTuneDiagRecord, crc));
+
+    const uint8_t* bytes = (const uint8_t*)&rec;
+    for (uint32_t i = 0; i < sizeof(rec); i++)
+    {
+        s_diag_ring[(s_diag_total + i) % QUICKTUNE_DIAG_RING_BYTES] = bytes[i];
+    }
+    s_diag_total += sizeof(rec);
+
+    QUICKTUNE_COMPILER_BARRIER();
+    s_diag_snap_valid = false;
+}
+#endif /* QUICKTUNE_DIAG_CAPTURE */
+
+/* ============================================================================
+ * PRIVATE FUNCTIONS - SWEEP ENGINE (SWEEP MODE)
+ * ============================================================================ */
+
+/**
+ * @brief Initialize the logarithmic sweep and per-band analysis windows
+ *
+ * The sweep trajectory is deterministic, so each band's analysis window
+ * is precomputed as a sample-index range: band b is measured while the
+ * instantaneous frequency lies between the geometric means with its
+ * neighbouring bands. Windows are contiguous and non-overlapping, so at
+ * most one band (two Goertzel detectors: mic + stimulus reference) is
+ * active per sample.
+ */
+static void Sweep_Init(void)
+{
+    s_sweep_phase = 0.0f;
+    s_sweep_freq = QUICKTUNE_SWEEP_START_HZ;
+
+    const float log_span = logf(QUICKTUNE_SWEEP_END_HZ / QUICKTUNE_SWEEP_START_HZ);
+    s_sweep_growth = expf(log_span / (float)(QUICKTUNE_SWEEP_TOTAL_SAMPLES - 1));
+
+    // Samples per unit of ln(frequency)
+    const float L = (float)QUICKTUNE_SWEEP_TOTAL_SAMPLES / log_span;
+
+    for (int band = 0; band < QUICKTUNE_NUM_BANDS; band++)
+    {
+        const float fc = QUICKTUNE_BAND_FREQUENCIES[band];
+
+        // Window edges: geometric means with the neighbouring bands
+        const float f_lo = (band == 0)
+            ? sqrtf(QUICKTUNE_SWEEP_START_HZ * fc)
+            : sqrtf(QUICKTUNE_BAND_FREQUENCIES[band - 1] * fc);
+        const float f_hi = (band == QUICKTUNE_NUM_BANDS - 1)
+            ? sqrtf(fc * QUICKTUNE_SWEEP_END_HZ)
+            : sqrtf(fc * QUICKTUNE_BAND_FREQUENCIES[band + 1]);
+
+        s_sweep_band_start[band] = (uint32_t)(L * logf(f_lo / QUICKTUNE_SWEEP_START_HZ));
+        s_sweep_band_end[band] = (uint32_t)(L * logf(f_hi / QUICKTUNE_SWEEP_START_HZ));
+
+        // Goertzel bin for this band's window length
+        const int num_samples = (int)(s_sweep_band_end[band] - s_sweep_band_start[band]);
+        const float k = (float)num_samples * fc / QUICKTUNE_SAMPLE_RATE + 0.5f;
+        const float w = (2.0f * M_PI * k) / num_samples;
+
+        #ifdef ARM_MATH_CM33
+        s_goertzel_bank_coeffs[band] = 2.0f * arm_cos_f32(w);
+        #else
+        s_goertzel_bank_coeffs[band] = 2.0f * cosf(w);
+        #endif
+
+        s_goertzel_bank_s1[band] = 0.0f;
+        s_goertzel_bank_s2[band] = 0.0f;
+        s_sweep_ref_s1[band] = 0.0f;
+        s_sweep_ref_s2[band] = 0.0f;
+    }
+
+    s_sweep_band = 0;
+    s_sample_counter = 0;
+}
+
+/**
+ * @brief Finalize one band's measurement from its sweep window
+ *
+ * The mic detector is referenced against the identical detector run on
+ * the generated stimulus, so window scalloping and sweep level cancel:
+ * the difference is the room transfer at the band frequency.
+ *
+ * @param band Band index (0-9)
+ */
+static void Sweep_FinalizeBand(int band)
+{
+    const int num_samples = (int)(s_sweep_band_end[band] - s_sweep_band_start[band]);
+
+    const float mic_db = Goertzel_FinalizeLevel(s_goertzel_bank_s1[band],
+                                                s_goertzel_bank_s2[band],
+                                                s_goertzel_bank_coeffs[band],
+                                                num_samples);
+    const float ref_db = Goertzel_FinalizeLevel(s_sweep_ref_s1[band],
+                                                s_sweep_ref_s2[band],
+                                                s_goertzel_bank_coeffs[band],
+                                                num_samples);
+
+    s_measured_levels[band] = mic_db - ref_db + QUICKTUNE_MEMS_CALIBRATION[band];
+    Event_Post(QUICKTUNE_EVENT_BAND_COMPLETE, (uint32_t)band);
+}
+
+/**
+ * @brief Generate one sweep sample and run the active band's detectors
+ *
+ * Per-sample sin() is acceptable here: the sweep runs only during
+ * calibration and arm_sin_f32 costs far less than the EQ10 budget.
+ *
+ * @param mic_sample Microphone input sample
+ * @return Stimulus sample for the speaker
+ */
+static inline float Sweep_Tick(float mic_sample)
+{
+    // Fade in/out to reduce clicks
+    float amplitude = QUICKTUNE_SWEEP_AMPLITUDE;
+    if (s_sample_counter < QUICKTUNE_FADE_SAMPLES)
+    {
+        amplitude *= (float)s_sample_counter / QUICKTUNE_FADE_SAMPLES;
+    }
+    else if (s_sample_counter >= QUICKTUNE_SWEEP_TOTAL_SAMPLES - QUICKTUNE_FADE_SAMPLES)
+    {
+        amplitude *= (float)(QUICKTUNE_SWEEP_TOTAL_SAMPLES - s_sample_counter) / QUICKTUNE_FADE_SAMPLES;
+    }
+
+    #ifdef ARM_MATH_CM33
+    const float out = amplitude * arm_sin_f32(s_sweep_phase);
+    #else
+    const float out = amplitude * sinf(s_sweep_phase);
+    #endif
+
+    // Advance the log sweep
+    s_sweep_phase += 2.0f * M_PI * s_sweep_freq / QUICKTUNE_SAMPLE_RATE;
+    if (s_sweep_phase > 2.0f * M_PI)
+    {
+        s_sweep_phase -= 2.0f * M_PI;
+    }
+    s_sweep_freq *= s_sweep_growth;
+
+    // Finalize bands whose windows have been fully swept
+    while (s_sweep_band < QUICKTUNE_NUM_BANDS &&
+           s_sample_counter >= s_sweep_band_end[s_sweep_band])
+    {
+        Sweep_FinalizeBand(s_sweep_band);
+        s_sweep_band++;
+    }
+
+    // Run the active band's detectors (stimulus reference + mic)
+    const int band = s_sweep_band;
+    if (band < QUICKTUNE_NUM_BANDS && s_sample_counter >= s_sweep_band_start[band])
+    {
+        const float coeff = s_goertzel_bank_coeffs[band];
+
+        const float r0 = coeff * s_sweep_ref_s1[band] - s_sweep_ref_s2[band] + out;
+        s_sweep_ref_s2[band] = s_sweep_ref_s1[band];
+        s_sweep_ref_s1[band] = r0;
+
+        const float m0 = coeff * s_goertzel_bank_s1[band] - s_goertzel_bank_s2[band] + mic_sample;
+        s_goertzel_bank_s2[band] = s_goertzel_bank_s1[band];
+        s_goertzel_bank_s1[band] = m0;
+    }
+
+    s_sample_counter++;
+
+    return out;
+}
+
+/* ============================================================================
+ * PRIVATE FUNCTIONS - STATE MACHINE
+ * ============================================================================ */
+
+/**
+ * @brief Find the end of the current homogeneous block segment
+ *
+ * Returns the next sample index at which the processing regime changes
+ * (fade-in end, analysis start/end, fade-out start, or tone end), so the
+ * block kernels can run branch-free within each segment.
+ *
+ * @param counter Current sample index within the tone
+ * @param settling Settling duration (samples)
+ * @param analysis Analysis duration (samples)
+ * @param total Total tone duration (samples)
+ * @return Sample index of the next boundary (> counter)
+ */
+static uint32_t SegmentLimit(uint32_t counter, uint32_t settling, uint32_t analysis, uint32_t total)
+{
+    const uint32_t bounds[4] = {
+        QUICKTUNE_FADE_SAMPLES,
+        settling,
+        settling + analysis,
+        total - QUICKTUNE_FADE_SAMPLES
+    };
+
+    uint32_t limit = total;
+    for (int i = 0; i < 4; i++)
+    {
+        if (bounds[i] > counter && bounds[i] < limit)
+        {
+            limit = bounds[i];
+        }
+    }
+    return limit;
+}
+
+/**
+ * @brief Start a parallel multi-tone measurement pass (all bands at once)
+ */
+static void StartParallelMeasurement(void)
+{
+    ToneBank_Init();
+    GoertzelBank_Init(QUICKTUNE_PARALLEL_ANALYSIS_SAMPLES);
+    s_sample_counter = 0;
+}
+
+/**
+ * @brief Mark the current measurement pass complete (audio path)
+ *
+ * Parks the state machine in COMPUTING and posts a pass-complete event.
+ * The gain computation and filter redesign run in
+ * QuickTune_ControlTask() on the main loop, never in the audio ISR.
+ */
+static void Measurement_Complete(void)
+{
+    s_state = QUICKTUNE_STATE_COMPUTING;
+    Event_Post(QUICKTUNE_EVENT_STATE_CHANGE, QUICKTUNE_STATE_COMPUTING);
+    CtrlQueue_Push(QT_CTRL_EVENT_PASS_COMPLETE);
+}
+
+/**
+ * @brief Physical band measured at the current sequential step
+ *
+ * Identity mapping unless a batch calibration rotated the order.
+ */
+static inline int CurrentBand(void)
+{
+    return (int)s_band_order[s_current_band];
+}
+
+/**
+ * @brief Start measurement of next band
+ */
+static void StartBandMeasurement(void)
+{
+    // Differential mode: skip bands deselected by the partial mask
+    while (s_partial_mask != 0 && s_current_band < QUICKTUNE_NUM_BANDS &&
+           ((s_partial_mask >> s_band_order[s_current_band]) & 1u) == 0)
+    {
+        s_current_band++;
+    }
+
+    if (s_current_band >= QUICKTUNE_NUM_BANDS)
+    {
+        // All bands measured, pass complete
+        Measurement_Complete();
+        return;
+    }
+
+    #if QUICKTUNE_ADAPTIVE_ANALYSIS
+    const int band = CurrentBand();
+    s_batch_slot_counter = 0;
+    s_batch_pad_remaining = 0;
+    // Chunk length: at least QUICKTUNE_ANALYSIS_CHUNK_SAMPLES, rounded up
+    // to whole cycles of fc so every chunk sees the same window phase.
+    // Windows and the matching Goertzel coefficients are constexpr
+    // tables (quicktune_tables.h); one Goertzel configuration is shared
+    // by the noise estimate and the tone chunks, so the SNR comparison
+    // is bin-for-bin consistent
+    #if QUICKTUNE_DECIMATED_ANALYSIS
+    s_decim_active = (QUICKTUNE_BAND_FREQUENCIES[band] < QUICKTUNE_DECIM_CROSSOVER_HZ);
+    if (s_decim_active)
+    {
+        // Sub-crossover band: detectors run at fs / QUICKTUNE_DECIM_FACTOR
+        // behind the anti-alias FIR; chunk lengths are in LOW-RATE samples
+        s_chunk_samples = QTCT_DECIM_WINDOWS.v[band];
+        s_goertzel_coeff = QTCT_DECIM_COEFFS.v[band];
+        arm_fir_decimate_init_f32(&s_decim_inst, QUICKTUNE_DECIM_NUM_TAPS,
+                                  QUICKTUNE_DECIM_FACTOR, QTCT_DECIM_FIR.c,
+                                  s_decim_fir_state, QUICKTUNE_DECIM_FACTOR);
+        memset(s_decim_fir_state, 0, sizeof(s_decim_fir_state));
+        s_decim_fill = 0;
+    }
+    else
+    #endif
+    {
+        s_chunk_samples = QTCT_CHUNK_WINDOWS.v[band];
+        s_goertzel_coeff = QTCT_CHUNK_COEFFS.v[band];
+    }
+    s_goertzel_s1 = 0.0f;
+    s_goertzel_s2 = 0.0f;
+
+    #if QUICKTUNE_HARMONIC_CAPTURE
+    // Harmonic detectors sit on exact integer bins of the whole-cycle
+    // chunk window, where the fundamental's leakage nulls out
+    #if QUICKTUNE_DECIMATED_ANALYSIS
+    if (s_decim_active)
+    {
+        s_h1_coeff = QTCT_DECIM_COEFFS_H1.v[band];
+        s_h2_coeff = QTCT_DECIM_COEFFS_H2.v[band];
+        s_h3_coeff = QTCT_DECIM_COEFFS_H3.v[band];
+    }
+    else
+    #endif
+    {
+        s_h1_coeff = QTCT_CHUNK_COEFFS_H1.v[band];
+        s_h2_coeff = QTCT_CHUNK_COEFFS_H2.v[band];
+        s_h3_coeff = QTCT_CHUNK_COEFFS_H3.v[band];
+    }
+    s_h1_s1 = 0.0f;
+    s_h1_s2 = 0.0f;
+    s_h2_s1 = 0.0f;
+    s_h2_s2 = 0.0f;
+    s_h3_s1 = 0.0f;
+    s_h3_s2 = 0.0f;
+    #endif
+
+    // Begin with the tone muted for the noise floor estimate
+    s_noise_phase = true;
+    s_chunk_counter = 0;
+    s_chunk_count = 0;
+    s_chunk_prev_db = 0.0f;
+    s_noise_power_sum = 0.0f;
+    s_tone_total = 0;
+    s_sample_counter = 0;
+    #else
+    const float frequency = QUICKTUNE_BAND_FREQUENCIES[CurrentBand()];
+
+    // Initialize tone generator
+    ToneGenerator_Init(frequency);
+
+    // Initialize Goertzel filter
+    Goertzel_Init(frequency, QUICKTUNE_TONE_ANALYSIS_SAMPLES);
+
+    // Reset sample counter
+    s_sample_counter = 0;
+    #endif
+}
+
+#if QUICKTUNE_ADAPTIVE_ANALYSIS
+
+/**
+ * @brief Finalize one completed analysis chunk and decide whether to stop
+ *
+ * Compares the chunk level against the previous chunk and the band's
+ * noise floor. The measurement terminates when the level has stabilized
+ * above the SNR target (early, in quiet rooms) or the maximum window is
+ * exhausted (flagged low-confidence). On termination the band level is
+ * the power-domain average of the last two chunks, diagnostics are
+ * recorded, and the tone fade-out is scheduled.
+ */
+static void AdaptiveChunk_Finalize(void)
+{
+    const int band = CurrentBand();
+
+    const float mag = Goertzel_FinalizeMagnitude(s_goertzel_s1, s_goertzel_s2,
+                                                 s_goertzel_coeff, (int)s_chunk_samples);
+    const float chunk_db = (mag > 1e-9f) ? 20.0f * log10f(mag) : -120.0f;
+
+    #if QUICKTUNE_HARMONIC_CAPTURE
+    const float h1_mag = Goertzel_FinalizeMagnitude(s_h1_s1, s_h1_s2,
+                                                    s_h1_coeff, (int)s_chunk_samples);
+    const float h2_mag = Goertzel_FinalizeMagnitude(s_h2_s1, s_h2_s2,
+                                                    s_h2_coeff, (int)s_chunk_samples);
+    const float h3_mag = Goertzel_FinalizeMagnitude(s_h3_s1, s_h3_s2,
+                                                    s_h3_coeff, (int)s_chunk_samples);
+    s_h1_s1 = 0.0f;
+    s_h1_s2 = 0.0f;
+    s_h2_s1 = 0.0f;
+    s_h2_s2 = 0.0f;
+    s_h3_s1 = 0.0f;
+    s_h3_s2 = 0.0f;
+    #endif
+
+    s_goertzel_s1 = 0.0f;
+    s_goertzel_s2 = 0.0f;
+    s_chunk_counter = 0;
+    s_chunk_count++;
+
+    const float snr_db = chunk_db - s_measure_diag.noise_floor_db[band];
+
+    bool done = false;
+    bool low_confidence = false;
+
+    if (s_chunk_count >= QUICKTUNE_ANALYSIS_MIN_CHUNKS &&
+        fabsf(chunk_db - s_chunk_prev_db) <= QUICKTUNE_ANALYSIS_SETTLE_TOL_DB &&
+        snr_db >= QUICKTUNE_TARGET_SNR_DB)
+    {
+        done = true;
+    }
+    else if (s_chunk_count >= QUICKTUNE_ANALYSIS_MAX_CHUNKS)
+    {
+        done = true;
+        low_confidence = true;
+    }
+
+    if (done)
+    {
+        // Band level: power-domain average of the last two chunks
+        float level_db = chunk_db;
+        if (s_chunk_count >= 2)
+        {
+            const float p = 0.5f * (powf(10.0f, chunk_db / 10.0f) +
+                                    powf(10.0f, s_chunk_prev_db / 10.0f));
+            level_db = 10.0f * log10f(p);
+        }
+
+        s_measured_levels[band] = level_db + QUICKTUNE_MEMS_CALIBRATION[band];
+        Event_Post(QUICKTUNE_EVENT_BAND_COMPLETE, (uint32_t)band);
+
+        s_measure_diag.snr_db[band] = level_db - s_measure_diag.noise_floor_db[band];
+        uint32_t analysis_samples = (uint32_t)s_chunk_count * s_chunk_samples;
+        #if QUICKTUNE_DECIMATED_ANALYSIS
+        if (s_decim_active)
+        {
+            // Report in full-rate samples like the full-rate bands
+            analysis_samples *= QUICKTUNE_DECIM_FACTOR;
+        }
+        #endif
+        s_measure_diag.analysis_samples[band] = analysis_samples;
+        if (low_confidence)
+        {
+            s_measure_diag.low_confidence_mask |= (uint16_t)(1u << band);
+            s_last_error = 5;  // Low-confidence measurement
+            Event_Post(QUICKTUNE_EVENT_ERROR, 5);
+        }
+        else
+        {
+            s_measure_diag.low_confidence_mask &= (uint16_t)~(1u << band);
+        }
+        s_measure_diag_valid = true;
+
+        #if QUICKTUNE_HARMONIC_CAPTURE
+        // Harmonic levels and THD from the terminating chunk. THD is
+        // relative to the exact-bin fundamental of the same chunk, so
+        // the ratio is immune to room gain and stimulus level
+        s_harmonic_levels.h2_db[band] = (h2_mag > 1e-9f) ? 20.0f * log10f(h2_mag) : -120.0f;
+        s_harmonic_levels.h3_db[band] = (h3_mag > 1e-9f) ? 20.0f * log10f(h3_mag) : -120.0f;
+        s_harmonic_levels.thd_percent[band] = (h1_mag > 1e-9f)
+            ? 100.0f * sqrtf(h2_mag * h2_mag + h3_mag * h3_mag) / h1_mag
+            : 0.0f;
+        s_harmonic_levels.valid_mask |= (uint16_t)(1u << band);
+        #endif
+
+        // Schedule the fade-out; the band advances when it completes
+        s_tone_total = s_sample_counter + QUICKTUNE_FADE_SAMPLES;
+    }
+
+    s_chunk_prev_db = chunk_db;
+}
+
+/**
+ * @brief Sequential-mode block processing, adaptive controller
+ *
+ * Per band: noise floor estimate (tone muted) -> fade-in -> whole-cycle
+ * analysis chunks with early termination -> fade-out -> next band.
+ * Replaces the fixed settling/analysis schedule of the non-adaptive
+ * sequential path.
+ *
+ * @param micInput Microphone input buffer
+ * @param speakerOutput Speaker output buffer
+ * @param numSamples Number of samples in buffers
+ */
+static void AdaptiveSequential_ProcessBlock(float* micInput, float* speakerOutput, int numSamples)
+{
+    int idx = 0;
+    while (idx < numSamples)
+    {
+        // StartBandMeasurement() may have advanced past the last band
+        if (s_state != QUICKTUNE_STATE_MEASURING)
+        {
+            memset(&speakerOutput[idx], 0, (numSamples - idx) * sizeof(float));
+            return;
+        }
+
+        if (s_batch_pad_remaining > 0)
+        {
+            // Batch mode: hold silence to the end of the fixed time slot
+            // so every unit on the line advances bands in lockstep
+            int seg = numSamples - idx;
+            if ((uint32_t)seg > s_batch_pad_remaining)
+            {
+                seg = (int)s_batch_pad_remaining;
+            }
+
+            memset(&speakerOutput[idx], 0, seg * sizeof(float));
+            s_batch_pad_remaining -= (uint32_t)seg;
+            idx += seg;
+
+            if (s_batch_pad_remaining == 0)
+            {
+                s_current_band++;
+                StartBandMeasurement();
+            }
+            continue;
+        }
+
+        if (s_noise_phase)
+        {
+            // Noise floor estimate: tone muted, Goertzel on the mic
+            int seg;
+            #if QUICKTUNE_DECIMATED_ANALYSIS
+            if (s_decim_active)
+            {
+                // Chunk counts low-rate samples; segment in full-rate
+                seg = (int)(s_chunk_samples - s_chunk_counter) * QUICKTUNE_DECIM_FACTOR
+                    - s_decim_fill;
+            }
+            else
+            #endif
+            {
+                seg = (int)(s_chunk_samples - s_chunk_counter);
+            }
+            if (seg > numSamples - idx)
+            {
+                seg = numSamples - idx;
+            }
+
+            memset(&speakerOutput[idx], 0, seg * sizeof(float));
+            #if QUICKTUNE_DECIMATED_ANALYSIS
+            if (s_decim_active)
+            {
+                Decim_ProcessBlock(&micInput[idx], seg, true, false);
+            }
+            else
+            #endif
+            {
+                Goertzel_ProcessBlock(&micInput[idx], seg);
+                s_chunk_counter += (uint32_t)seg;
+            }
+            s_batch_slot_counter += (uint32_t)seg;
+            idx += seg;
+
+            if (s_chunk_counter >= s_chunk_samples)
+            {
+                const float mag = Goertzel_FinalizeMagnitude(s_goertzel_s1, s_goertzel_s2,
+                                                             s_goertzel_coeff,
+                                                             (int)s_chunk_samples);
+                s_noise_power_sum += mag * mag;
+                s_goertzel_s1 = 0.0f;
+                s_goertzel_s2 = 0.0f;
+                s_chunk_counter = 0;
+                s_chunk_count++;
+
+                if (s_chunk_count >= QUICKTUNE_NOISE_EST_CHUNKS)
+                {
+                    const float noise_mag =
+                        sqrtf(s_noise_power_sum / (float)QUICKTUNE_NOISE_EST_CHUNKS);
+                    s_measure_diag.noise_floor_db[CurrentBand()] =
+                        (noise_mag > 1e-9f) ? 20.0f * log10f(noise_mag) : -120.0f;
+
+                    // Switch to the stimulus phase
+                    ToneGenerator_Init(QUICKTUNE_BAND_FREQUENCIES[CurrentBand()]);
+                    s_noise_phase = false;
+                    s_chunk_count = 0;
+                    s_tone_total = 0;
+                    s_sample_counter = 0;
+                }
+            }
+            continue;
+        }
+
+        // Stimulus phase: segment at the fade-in end, chunk boundaries
+        // and the scheduled fade-out, like SegmentLimit() does for the
+        // fixed schedule
+        const uint32_t total = (s_tone_total != 0) ? s_tone_total : 0xFFFFFFFFu;
+        uint32_t limit;
+        if (s_tone_total != 0)
+        {
+            limit = s_tone_total;
+        }
+        else if (s_sample_counter < QUICKTUNE_FADE_SAMPLES)
+        {
+            limit = QUICKTUNE_FADE_SAMPLES;
+        }
+        else
+        {
+            #if QUICKTUNE_DECIMATED_ANALYSIS
+            if (s_decim_active)
+            {
+                limit = s_sample_counter
+                      + (s_chunk_samples - s_chunk_counter) * QUICKTUNE_DECIM_FACTOR
+                      - (uint32_t)s_decim_fill;
+            }
+            else
+            #endif
+            {
+                limit = s_sample_counter + (s_chunk_samples - s_chunk_counter);
+            }
+        }
+
+        int seg = (int)(limit - s_sample_counter);
+        if (seg > numSamples - idx)
+        {
+            seg = numSamples - idx;
+        }
+
+        ToneGenerator_FillBlock(&speakerOutput[idx], seg, total);
+
+        // Analyze once the fade-in has completed and until termination
+        if (s_tone_total == 0 && s_sample_counter >= QUICKTUNE_FADE_SAMPLES)
+        {
+            #if QUICKTUNE_DECIMATED_ANALYSIS
+            if (s_decim_active)
+            {
+                Decim_ProcessBlock(&micInput[idx], seg, true, true);
+            }
+            else
+            #endif
+            {
+                Goertzel_ProcessBlock(&micInput[idx], seg);
+                #if QUICKTUNE_HARMONIC_CAPTURE
+                Goertzel_ProcessBlockHarmonics(&micInput[idx], seg);
+                #endif
+                s_chunk_counter += (uint32_t)seg;
+            }
+        }
+        #if QUICKTUNE_DECIMATED_ANALYSIS
+        else if (s_decim_active && s_tone_total == 0)
+        {
+            // Fade-in: keep the FIR delay line tracking the mic so the
+            // first analysis frame sees no discontinuity
+            Decim_ProcessBlock(&micInput[idx], seg, false, false);
+        }
+        #endif
+
+        s_sample_counter += seg;
+        s_batch_slot_counter += (uint32_t)seg;
+        idx += seg;
+
+        if (s_tone_total == 0)
+        {
+            if (s_chunk_counter >= s_chunk_samples)
+            {
+                AdaptiveChunk_Finalize();
+            }
+        }
+        else if (s_sample_counter >= s_tone_total)
+        {
+            // Fade-out complete - move to the next band. In batch mode
+            // first pad the slot to its fixed length (early-terminating
+            // bands would otherwise break the inter-unit lockstep)
+            if (s_batch_units > 1 &&
+                s_batch_slot_counter < QUICKTUNE_BATCH_SLOT_SAMPLES)
+            {
+                s_batch_pad_remaining =
+                    QUICKTUNE_BATCH_SLOT_SAMPLES - s_batch_slot_counter;
+            }
+            else
+            {
+                s_current_band++;
+                StartBandMeasurement();
+            }
+        }
+    }
+}
+
+#endif /* QUICKTUNE_ADAPTIVE_ANALYSIS */
+
+/**
+ * @brief Start a measurement pass in the active mode
+ */
+static void StartMeasurementPass(void)
+{
+    s_current_band = 0;
+
+    if (s_mode == QUICKTUNE_MODE_PARALLEL)
+    {
+        StartParallelMeasurement();
+    }
+    else if (s_mode == QUICKTUNE_MODE_SWEEP)
+    {
+        Sweep_Init();
+    }
+    else
+    {
+        StartBandMeasurement();
+    }
+}
+
+/**
+ * @brief Merge a completed measurement pass into the spatial average
+ *
+ * Multi-position mode only, first iteration only (the refinement
+ * iterations measure at the final mic position like a normal run).
+ * Each position's band levels are folded into a weighted power-domain
+ * running sum, so memory stays O(bands) regardless of position count.
+ *
+ * @return true if the pass was consumed and the state machine parked in
+ *         WAITING_POSITION (more positions needed); false if the
+ *         caller should continue into ComputeCorrectionGains() - with
+ *         s_measured_levels holding the merged average when all
+ *         positions are in
+ */
+static bool MultiPosition_OnPassComplete(void)
+{
+    if (s_mp_total <= 1 || s_iteration != 0)
+    {
+        return false;
+    }
+
+    // Fold this position into the weighted power average. Power domain
+    // (not dB) so a deep null at one position cannot dominate the
+    // compromise the way a dB average would let it.
+    const float w = s_mp_weights[s_mp_done];
+    for (int band = 0; band < QUICKTUNE_NUM_BANDS; band++)
+    {
+        s_mp_power_sum[band] += w * powf(10.0f, s_measured_levels[band] / 10.0f);
+    }
+    s_mp_weight_sum += w;
+    s_mp_done++;
+
+    if (s_mp_done < s_mp_total)
+    {
+        // Park until the user confirms the mic has been moved
+        s_state = QUICKTUNE_STATE_WAITING_POSITION;
+        Event_Dispatch(QUICKTUNE_EVENT_STATE_CHANGE, QUICKTUNE_STATE_WAITING_POSITION);
+        return true;
+    }
+
+    // All positions in: replace the last position's levels with the
+    // weighted average; correction proceeds unchanged from here
+    for (int band = 0; band < QUICKTUNE_NUM_BANDS; band++)
+    {
+        const float avg_power = s_mp_power_sum[band] / s_mp_weight_sum;
+        s_measured_levels[band] = (avg_power > 1e-12f)
+            ? 10.0f * log10f(avg_power) : -120.0f;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Compute correction gains from measured levels
+ */
+static void ComputeCorrectionGains(void)
+{
+    for (int band = 0; band < QUICKTUNE_NUM_BANDS; band++)
+    {
+        // Differential mode: bands outside the mask were not measured
+        // this run - keep their stored correction untouched
+        if (s_partial_mask != 0 && ((s_partial_mask >> band) & 1u) == 0)
+        {
+            continue;
+        }
+
+        // Target is 0 dB (flat response)
+        // Correction gain = target - measured
+        float gain = -s_measured_levels[band];
+
+        // Clip to ±12 dB
+        if (gain > QUICKTUNE_MAX_GAIN_DB)
+            gain = QUICKTUNE_MAX_GAIN_DB;
+        if (gain < QUICKTUNE_MIN_GAIN_DB)
+            gain = QUICKTUNE_MIN_GAIN_DB;
+
+        s_correction_gains[band] = gain;
+
+        // Update cumulative gains (for iterative refinement)
+        if (s_partial_mask != 0)
+        {
+            // Differential touch-up: the stimulus passed through the
+            // live converged preset, so the measurement is already a
+            // residual. Apply it in full - the damping factor exists to
+            // stabilize repeated passes, and a partial run makes one.
+            s_cumulative_gains[band] += gain;
+
+            if (s_cumulative_gains[band] > QUICKTUNE_MAX_GAIN_DB)
+                s_cumulative_gains[band] = QUICKTUNE_MAX_GAIN_DB;
+            if (s_cumulative_gains[band] < QUICKTUNE_MIN_GAIN_DB)
+                s_cumulative_gains[band] = QUICKTUNE_MIN_GAIN_DB;
+        }
+        else if (s_iteration == 0)
+        {
+            s_cumulative_gains[band] = gain;
+        }
+        else
         {
             // Apply damping to prevent overcorrection
             s_cumulative_gains[band] += gain * QUICKTUNE_DAMPING_FACTOR;
@@ -305,23 +1930,104 @@ static void ComputeCorrectionGains(void)
  */
 static void ApplyCorrectionGains(void)
 {
-    EQ10_SetAllGains(s_cumulative_gains, QUICKTUNE_EQ_Q);
+    if (s_partial_mask != 0)
+    {
+        // Differential touch-up: redesign only the remeasured bands
+        // through the per-band setter - the other biquads keep their
+        // live coefficients bit-for-bit. The deltas are small (drift,
+        // not a fresh room), so the immediate per-band publish replaces
+        // the full ten-band ramp, and no refinement iterations run.
+        for (int band = 0; band < QUICKTUNE_NUM_BANDS; band++)
+        {
+            if ((s_partial_mask >> band) & 1u)
+            {
+                EQ10_SetBandGain(band, s_cumulative_gains[band], QUICKTUNE_EQ_Q);
+            }
+        }
+
+        QUICKTUNE_COMPILER_BARRIER();
+        s_state = QUICKTUNE_STATE_DONE;
+        Event_Dispatch(QUICKTUNE_EVENT_STATE_CHANGE, QUICKTUNE_STATE_DONE);
+        return;
+    }
+
+    // Hand the redesigns to the EQ10 scheduler, which amortizes them
+    // over blocks (EQ10_RAMP_BANDS_PER_BLOCK per block) instead of
+    // running all ten in one go. The machine parks in APPLYING until
+    // the ramp completion callback posts QT_CTRL_EVENT_APPLY_COMPLETE.
+    EQ10_RampToGains(s_cumulative_gains, QUICKTUNE_EQ_Q, QUICKTUNE_APPLY_RAMP_BLOCKS);
+    QUICKTUNE_COMPILER_BARRIER();
+    s_state = QUICKTUNE_STATE_APPLYING;
+    Event_Dispatch(QUICKTUNE_EVENT_STATE_CHANGE, QUICKTUNE_STATE_APPLYING);
+}
+
+/**
+ * @brief Continue after the applied correction is fully live (control task)
+ *
+ * Runs the iterate-or-finish decision that used to follow the
+ * instantaneous apply. The next measurement pass only ever starts
+ * against coefficients that are already in the audio path, so an
+ * iteration never measures a half-applied response.
+ */
+static void ApplyComplete(void)
+{
+    Event_Dispatch(QUICKTUNE_EVENT_ITERATION_COMPLETE, (uint32_t)s_iteration);
 
     // Check if we should iterate
     #if QUICKTUNE_ENABLE_ITERATION
     if (s_iteration < QUICKTUNE_MAX_ITERATIONS - 1)
     {
-        // Start next iteration
+        // Start next iteration: configure the pass fully before the
+        // state store hands the machine back to the audio ISR
         s_iteration++;
-        s_current_band = 0;
+        StartMeasurementPass();
+        QUICKTUNE_COMPILER_BARRIER();
         s_state = QUICKTUNE_STATE_MEASURING;
-        StartBandMeasurement();
+        Event_Dispatch(QUICKTUNE_EVENT_STATE_CHANGE, QUICKTUNE_STATE_MEASURING);
         return;
     }
     #endif
 
     // Done
     s_state = QUICKTUNE_STATE_DONE;
+    Event_Dispatch(QUICKTUNE_EVENT_STATE_CHANGE, QUICKTUNE_STATE_DONE);
+}
+
+/**
+ * @brief EQ10 ramp completion hook (audio context)
+ *
+ * Registered with EQ10_SetRampCompleteCallback() at init; posts the
+ * apply-complete event when the calibration state machine is waiting
+ * on a coefficient apply. Ramps the application runs for its own
+ * purposes (outside APPLYING) are ignored.
+ */
+static void OnEq10RampComplete(void* context)
+{
+    (void)context;
+
+    if (s_state == QUICKTUNE_STATE_APPLYING)
+    {
+        CtrlQueue_Push(QT_CTRL_EVENT_APPLY_COMPLETE);
+    }
+}
+
+/**
+ * @brief Return to single-unit operation (identity band order, no padding)
+ *
+ * Called from init and from the non-batch start paths, so a plain start
+ * never inherits a stale batch configuration.
+ */
+static void BatchDisable(void)
+{
+    s_batch_units = 0;
+    for (int i = 0; i < QUICKTUNE_NUM_BANDS; i++)
+    {
+        s_band_order[i] = (uint8_t)i;
+    }
+    #if QUICKTUNE_ADAPTIVE_ANALYSIS
+    s_batch_slot_counter = 0;
+    s_batch_pad_remaining = 0;
+    #endif
 }
 
 /* ============================================================================
@@ -330,80 +2036,462 @@ static void ApplyCorrectionGains(void)
 
 void QuickTune_Init(void)
 {
-    // Initialize EQ10
+    #if QUICKTUNE_ENABLE_PROFILING
+    // Enable the DWT cycle counter and clear all counters
+    QTProf_Init();
+    #endif
+    QuickTune_ResetPerfStats();
+
+    // Initialize EQ10 and hook its coefficient scheduler, so the state
+    // machine can wait for applied corrections to be fully live
     EQ10_Init();
+    EQ10_SetRampCompleteCallback(OnEq10RampComplete, NULL);
 
-    // Precompute Goertzel coefficients for all bands
-    for (int band = 0; band < QUICKTUNE_NUM_BANDS; band++)
-    {
-        const float frequency = QUICKTUNE_BAND_FREQUENCIES[band];
-        const float N_f = (float)QUICKTUNE_TONE_ANALYSIS_SAMPLES;
-        const float k = N_f * frequency / (float)QUICKTUNE_SAMPLE_RATE + 0.5f;
-        const float w = (2.0f * (float)M_PI * k) / N_f;
+    // Goertzel coefficients for all bands come from the constexpr table
+    // (quicktune_tables.h) - no per-band cosf at startup
+    memcpy(s_goertzel_coeffs, QTCT_GOERTZEL_SEQ.v, sizeof(s_goertzel_coeffs));
 
-        #ifdef ARM_MATH_CM33
-        s_goertzel_coeffs[band] = 2.0f * arm_cos_f32(w);
-        #else
-        s_goertzel_coeffs[band] = 2.0f * cosf(w);
-        #endif
-    }
+    #if QUICKTUNE_DIAG_CAPTURE
+    memcpy(s_diag_coeffs, QTCT_DIAG_COEFFS.v, sizeof(s_diag_coeffs));
+    DiagCapture_Reset();
+    #endif
 
     // Initialize state
     s_state = QUICKTUNE_STATE_IDLE;
+    s_mode = QUICKTUNE_MODE_PARALLEL;
     s_current_band = 0;
     s_sample_counter = 0;
     s_iteration = 0;
     s_last_error = 0;
+    BatchDisable();
+    s_partial_mask = 0;
+    s_event_cb = NULL;
+    s_event_ctx = NULL;
+    s_event_queue_head = 0;
+    s_event_queue_tail = 0;
 
     memset(s_measured_levels, 0, sizeof(s_measured_levels));
     memset(s_correction_gains, 0, sizeof(s_correction_gains));
     memset(s_cumulative_gains, 0, sizeof(s_cumulative_gains));
+
+    s_mp_total = 0;
+    s_mp_done = 0;
+    s_mp_weight_sum = 0.0f;
+    memset(s_mp_power_sum, 0, sizeof(s_mp_power_sum));
+
+    // Drain any stale control events (consumer-side reset)
+    s_ctrl_queue_tail = s_ctrl_queue_head;
+
+    #if QUICKTUNE_ADAPTIVE_ANALYSIS
+    memset(&s_measure_diag, 0, sizeof(s_measure_diag));
+    s_measure_diag_valid = false;
+    #if QUICKTUNE_HARMONIC_CAPTURE
+    memset(&s_harmonic_levels, 0, sizeof(s_harmonic_levels));
+    #endif
+    #endif
 }
 
-bool QuickTune_Start(void)
+bool QuickTune_Start(QuickTuneMode mode)
 {
     if (s_state != QUICKTUNE_STATE_IDLE)
     {
         s_last_error = 1;  // Invalid state
+        Event_Dispatch(QUICKTUNE_EVENT_ERROR, 1);
         return false;
     }
 
-    // Reset iteration counter
+    // Reset iteration counter; single-position run
     s_iteration = 0;
-    s_current_band = 0;
+    s_mode = mode;
+    s_mp_total = 0;
+    s_mp_done = 0;
+    BatchDisable();
+    s_partial_mask = 0;
+    #if QUICKTUNE_DIAG_CAPTURE
+    DiagCapture_Reset();
+    #endif
 
-    // Start measuring
+    // Configure the pass fully before handing the machine to the ISR
+    StartMeasurementPass();
+    QUICKTUNE_COMPILER_BARRIER();
     s_state = QUICKTUNE_STATE_MEASURING;
-    StartBandMeasurement();
+    Event_Dispatch(QUICKTUNE_EVENT_STATE_CHANGE, QUICKTUNE_STATE_MEASURING);
 
     return true;
 }
 
-void QuickTune_ProcessBlock(float* micInput, float* speakerOutput, int numSamples)
+bool QuickTune_StartBatch(int unitIndex, int numUnits)
+{
+    if (s_state != QUICKTUNE_STATE_IDLE)
+    {
+        s_last_error = 1;  // Invalid state
+        Event_Dispatch(QUICKTUNE_EVENT_ERROR, 1);
+        return false;
+    }
+
+    if (numUnits < 1 || numUnits > QUICKTUNE_NUM_BANDS ||
+        unitIndex < 0 || unitIndex >= numUnits)
+    {
+        s_last_error = 3;  // Invalid parameters
+        Event_Dispatch(QUICKTUNE_EVENT_ERROR, 3);
+        return false;
+    }
+
+    // Rotate the band order by the unit index: with the fixed-length
+    // band slots, units sharing a time slot then always stimulate
+    // disjoint frequencies, so their tones fall outside each other's
+    // Goertzel bins (the harmonic 2f/3f bins are disjoint from the
+    // other units' fundamentals too - no band is a multiple of another)
+    for (int i = 0; i < QUICKTUNE_NUM_BANDS; i++)
+    {
+        s_band_order[i] = (uint8_t)((i + unitIndex) % QUICKTUNE_NUM_BANDS);
+    }
+    s_batch_units = numUnits;
+    #if QUICKTUNE_ADAPTIVE_ANALYSIS
+    s_batch_slot_counter = 0;
+    s_batch_pad_remaining = 0;
+    #endif
+
+    // Sequential stimulus only - parallel and sweep modes excite all
+    // bands at once and cannot be deconflicted across units
+    s_iteration = 0;
+    s_mode = QUICKTUNE_MODE_SEQUENTIAL;
+    s_mp_total = 0;
+    s_mp_done = 0;
+    s_partial_mask = 0;
+    #if QUICKTUNE_DIAG_CAPTURE
+    DiagCapture_Reset();
+    #endif
+
+    StartMeasurementPass();
+    QUICKTUNE_COMPILER_BARRIER();
+    s_state = QUICKTUNE_STATE_MEASURING;
+    Event_Dispatch(QUICKTUNE_EVENT_STATE_CHANGE, QUICKTUNE_STATE_MEASURING);
+
+    return true;
+}
+
+void QuickTune_SetEventCallback(QuickTuneEventCallback callback, void* context)
+{
+    // Stop ISR posts while swapping: on the single core an ISR either
+    // ran entirely before or entirely after the NULL store, so no post
+    // can interleave with the context/queue update
+    s_event_cb = NULL;
+    QUICKTUNE_COMPILER_BARRIER();
+    s_event_queue_tail = s_event_queue_head;    // Drop undelivered events
+    s_event_ctx = context;
+    QUICKTUNE_COMPILER_BARRIER();
+    s_event_cb = callback;
+}
+
+bool QuickTune_StartPartial(uint16_t bandMask)
+{
+    if (s_state != QUICKTUNE_STATE_IDLE)
+    {
+        s_last_error = 1;  // Invalid state
+        Event_Dispatch(QUICKTUNE_EVENT_ERROR, 1);
+        return false;
+    }
+
+    if (bandMask == 0 ||
+        (bandMask & (uint16_t)~((1u << QUICKTUNE_NUM_BANDS) - 1u)) != 0)
+    {
+        s_last_error = 3;  // Invalid parameters
+        Event_Dispatch(QUICKTUNE_EVENT_ERROR, 3);
+        return false;
+    }
+
+    // Touch-up pass: remeasure only the masked bands and keep the stored
+    // levels/gains for the rest.  Sequential stimulus only (parallel and
+    // sweep modes excite all bands at once), single-position, and a
+    // single iteration - refinement passes exist to converge a cold
+    // start, not to nudge an already-converged preset.
+    s_iteration = 0;
+    s_mode = QUICKTUNE_MODE_SEQUENTIAL;
+    s_mp_total = 0;
+    s_mp_done = 0;
+    BatchDisable();
+    s_partial_mask = bandMask;
+    #if QUICKTUNE_DIAG_CAPTURE
+    DiagCapture_Reset();
+    #endif
+
+    StartMeasurementPass();
+    QUICKTUNE_COMPILER_BARRIER();
+    s_state = QUICKTUNE_STATE_MEASURING;
+    Event_Dispatch(QUICKTUNE_EVENT_STATE_CHANGE, QUICKTUNE_STATE_MEASURING);
+
+    return true;
+}
+
+uint32_t QuickTune_GetStatusWord(void)
+{
+    const QuickTuneState state = s_state;
+
+    uint32_t band = QUICKTUNE_STATUS_BAND_NONE;
+    if (state == QUICKTUNE_STATE_MEASURING && s_mode == QUICKTUNE_MODE_SEQUENTIAL &&
+        s_current_band < QUICKTUNE_NUM_BANDS)
+    {
+        band = (uint32_t)s_band_order[s_current_band];
+    }
+
+    float progress = QuickTune_GetProgress();
+    if (progress < 0.0f)
+    {
+        progress = 0.0f;
+    }
+    if (progress > 1.0f)
+    {
+        progress = 1.0f;
+    }
+
+    uint32_t word =
+        (((uint32_t)state << QUICKTUNE_STATUS_STATE_SHIFT) & QUICKTUNE_STATUS_STATE_MASK)
+      | ((band << QUICKTUNE_STATUS_BAND_SHIFT) & QUICKTUNE_STATUS_BAND_MASK)
+      | (((uint32_t)s_iteration << QUICKTUNE_STATUS_ITER_SHIFT) & QUICKTUNE_STATUS_ITER_MASK)
+      | (((uint32_t)s_last_error << QUICKTUNE_STATUS_ERROR_SHIFT) & QUICKTUNE_STATUS_ERROR_MASK)
+      | (((uint32_t)(progress * 255.0f + 0.5f) << QUICKTUNE_STATUS_PROGRESS_SHIFT)
+         & QUICKTUNE_STATUS_PROGRESS_MASK)
+      | (((uint32_t)s_mp_done << QUICKTUNE_STATUS_POS_SHIFT) & QUICKTUNE_STATUS_POS_MASK);
+
+    #if QUICKTUNE_ADAPTIVE_ANALYSIS
+    if (s_measure_diag.low_confidence_mask != 0)
+    {
+        word |= QUICKTUNE_STATUS_FLAG_LOW_CONF;
+    }
+    #endif
+    if (EQ10_IsRamping())
+    {
+        word |= QUICKTUNE_STATUS_FLAG_RAMPING;
+    }
+    if (s_batch_units > 1)
+    {
+        word |= QUICKTUNE_STATUS_FLAG_BATCH;
+    }
+
+    return word;
+}
+
+bool QuickTune_StartMultiPosition(QuickTuneMode mode, int numPositions,
+                                  const float* weights)
+{
+    if (s_state != QUICKTUNE_STATE_IDLE)
+    {
+        s_last_error = 1;  // Invalid state
+        Event_Dispatch(QUICKTUNE_EVENT_ERROR, 1);
+        return false;
+    }
+
+    if (numPositions < 1 || numPositions > QUICKTUNE_MAX_POSITIONS)
+    {
+        s_last_error = 3;  // Invalid parameters
+        Event_Dispatch(QUICKTUNE_EVENT_ERROR, 3);
+        return false;
+    }
+
+    for (int pos = 0; pos < numPositions; pos++)
+    {
+        const float w = (weights != NULL) ? weights[pos] : 1.0f;
+        if (!(w > 0.0f))
+        {
+            s_last_error = 3;  // Invalid parameters
+            Event_Dispatch(QUICKTUNE_EVENT_ERROR, 3);
+            return false;
+        }
+        s_mp_weights[pos] = w;
+    }
+
+    s_iteration = 0;
+    s_mode = mode;
+    s_mp_total = numPositions;
+    s_mp_done = 0;
+    BatchDisable();
+    s_partial_mask = 0;
+    s_mp_weight_sum = 0.0f;
+    memset(s_mp_power_sum, 0, sizeof(s_mp_power_sum));
+    #if QUICKTUNE_DIAG_CAPTURE
+    DiagCapture_Reset();
+    #endif
+
+    StartMeasurementPass();
+    QUICKTUNE_COMPILER_BARRIER();
+    s_state = QUICKTUNE_STATE_MEASURING;
+    Event_Dispatch(QUICKTUNE_EVENT_STATE_CHANGE, QUICKTUNE_STATE_MEASURING);
+
+    return true;
+}
+
+bool QuickTune_ConfirmPosition(void)
+{
+    if (s_state != QUICKTUNE_STATE_WAITING_POSITION)
+    {
+        s_last_error = 1;  // Invalid state
+        Event_Dispatch(QUICKTUNE_EVENT_ERROR, 1);
+        return false;
+    }
+
+    StartMeasurementPass();
+    QUICKTUNE_COMPILER_BARRIER();
+    s_state = QUICKTUNE_STATE_MEASURING;
+    Event_Dispatch(QUICKTUNE_EVENT_STATE_CHANGE, QUICKTUNE_STATE_MEASURING);
+
+    return true;
+}
+
+int QuickTune_GetPositionsMeasured(void)
+{
+    return s_mp_done;
+}
+
+/**
+ * @brief State machine block processing (see QuickTune_ProcessBlock)
+ *
+ * Split out from the public entry point so the profiling wrapper can
+ * time it across the multiple internal return paths.
+ */
+static void QuickTune_ProcessBlockImpl(float* micInput, float* speakerOutput, int numSamples)
 {
-    if (s_state == QUICKTUNE_STATE_IDLE || s_state == QUICKTUNE_STATE_DONE || s_state == QUICKTUNE_STATE_ERROR)
+    if (s_state != QUICKTUNE_STATE_MEASURING)
     {
-        // Not calibrating, output silence
+        // Idle, waiting (mic move / control task), done or error: the
+        // ISR has no sample-rate work. COMPUTING and APPLYING are
+        // handled by QuickTune_ControlTask() on the main loop, so the
+        // worst-case ISR block is the measurement path itself.
+        if (s_state == QUICKTUNE_STATE_APPLYING)
+        {
+            // Pace the amortized coefficient apply at block rate even
+            // when the host is not running the EQ10 cascade during
+            // calibration; the completion callback posts the event
+            // that resumes the state machine
+            EQ10_RampService();
+        }
         memset(speakerOutput, 0, numSamples * sizeof(float));
         return;
     }
 
-    if (s_state == QUICKTUNE_STATE_MEASURING)
+    #if QUICKTUNE_DIAG_CAPTURE
+    // Room response snapshot bank runs on the raw mic for every
+    // measuring mode, alongside whichever detectors the mode uses
+    DiagCapture_ProcessBlock(micInput, numSamples);
+    #endif
+
+    if (s_state == QUICKTUNE_STATE_MEASURING && s_mode == QUICKTUNE_MODE_SWEEP)
     {
-        // Generate tone and analyze microphone input
+        // Generate the log sweep and analyze the active band's window
         for (int i = 0; i < numSamples; i++)
         {
-            // Generate tone sample
-            speakerOutput[i] = ToneGenerator_GetSample(s_sample_counter);
+            speakerOutput[i] = Sweep_Tick(micInput[i]);
+
+            // Check if sweep complete
+            if (s_sample_counter >= QUICKTUNE_SWEEP_TOTAL_SAMPLES)
+            {
+                // Finalize any remaining bands
+                while (s_sweep_band < QUICKTUNE_NUM_BANDS)
+                {
+                    Sweep_FinalizeBand(s_sweep_band);
+                    s_sweep_band++;
+                }
+
+                Measurement_Complete();
+
+                // Fill rest of block with silence
+                for (int j = i + 1; j < numSamples; j++)
+                {
+                    speakerOutput[j] = 0.0f;
+                }
+
+                return;
+            }
+        }
+    }
+    else if (s_state == QUICKTUNE_STATE_MEASURING && s_mode == QUICKTUNE_MODE_PARALLEL)
+    {
+        // Generate composite multi-tone stimulus, run all detectors at once.
+        // The block is split into homogeneous segments so the kernels run
+        // branch-free inside each segment.
+        int idx = 0;
+        while (idx < numSamples)
+        {
+            const uint32_t limit = SegmentLimit(s_sample_counter,
+                                                QUICKTUNE_PARALLEL_SETTLING_SAMPLES,
+                                                QUICKTUNE_PARALLEL_ANALYSIS_SAMPLES,
+                                                QUICKTUNE_PARALLEL_TOTAL_SAMPLES);
+            int seg = (int)(limit - s_sample_counter);
+            if (seg > numSamples - idx)
+            {
+                seg = numSamples - idx;
+            }
+
+            ToneBank_FillBlock(&speakerOutput[idx], seg);
+
+            // Analyze microphone input (skip settling period)
+            if (s_sample_counter >= QUICKTUNE_PARALLEL_SETTLING_SAMPLES &&
+                s_sample_counter < QUICKTUNE_PARALLEL_SETTLING_SAMPLES + QUICKTUNE_PARALLEL_ANALYSIS_SAMPLES)
+            {
+                GoertzelBank_ProcessBlock(&micInput[idx], seg);
+            }
+
+            s_sample_counter += seg;
+            idx += seg;
+
+            // Check if measurement pass complete
+            if (s_sample_counter >= QUICKTUNE_PARALLEL_TOTAL_SAMPLES)
+            {
+                // Finalize all bands at once
+                for (int band = 0; band < QUICKTUNE_NUM_BANDS; band++)
+                {
+                    float level_db = GoertzelBank_GetLevel(band, QUICKTUNE_PARALLEL_ANALYSIS_SAMPLES);
+
+                    // Apply MEMS calibration
+                    level_db += QUICKTUNE_MEMS_CALIBRATION[band];
+
+                    s_measured_levels[band] = level_db;
+                }
+
+                Measurement_Complete();
+
+                // Fill rest of block with silence
+                for (int j = idx; j < numSamples; j++)
+                {
+                    speakerOutput[j] = 0.0f;
+                }
+
+                return;
+            }
+        }
+    }
+    else if (s_state == QUICKTUNE_STATE_MEASURING)
+    {
+        #if QUICKTUNE_ADAPTIVE_ANALYSIS
+        // Adaptive controller: noise floor estimate + chunked analysis
+        // with early termination (see quicktune_config.h)
+        AdaptiveSequential_ProcessBlock(micInput, speakerOutput, numSamples);
+        #else
+        // Generate tone and analyze microphone input, segment by segment
+        int idx = 0;
+        while (idx < numSamples)
+        {
+            const uint32_t limit = SegmentLimit(s_sample_counter,
+                                                QUICKTUNE_TONE_SETTLING_SAMPLES,
+                                                QUICKTUNE_TONE_ANALYSIS_SAMPLES,
+                                                QUICKTUNE_TONE_TOTAL_SAMPLES);
+            int seg = (int)(limit - s_sample_counter);
+            if (seg > numSamples - idx)
+            {
+                seg = numSamples - idx;
+            }
+
+            ToneGenerator_FillBlock(&speakerOutput[idx], seg, QUICKTUNE_TONE_TOTAL_SAMPLES);
 
             // Analyze microphone input (skip settling period)
             if (s_sample_counter >= QUICKTUNE_TONE_SETTLING_SAMPLES &&
                 s_sample_counter < QUICKTUNE_TONE_SETTLING_SAMPLES + QUICKTUNE_TONE_ANALYSIS_SAMPLES)
             {
-                Goertzel_ProcessSample(micInput[i]);
+                Goertzel_ProcessBlock(&micInput[idx], seg);
             }
 
-            s_sample_counter++;
+            s_sample_counter += seg;
+            idx += seg;
 
             // Check if tone complete
             if (s_sample_counter >= QUICKTUNE_TONE_TOTAL_SAMPLES)
@@ -412,41 +2500,92 @@ void QuickTune_ProcessBlock(float* micInput, float* speakerOutput, int numSample
                 float level_db = Goertzel_GetPower(QUICKTUNE_TONE_ANALYSIS_SAMPLES);
 
                 // Apply MEMS calibration
-                level_db += QUICKTUNE_MEMS_CALIBRATION[s_current_band];
+                level_db += QUICKTUNE_MEMS_CALIBRATION[CurrentBand()];
 
                 // Store measured level
-                s_measured_levels[s_current_band] = level_db;
+                s_measured_levels[CurrentBand()] = level_db;
+                Event_Post(QUICKTUNE_EVENT_BAND_COMPLETE, (uint32_t)CurrentBand());
 
                 // Move to next band
                 s_current_band++;
                 StartBandMeasurement();
 
                 // Fill rest of block with silence
-                for (int j = i + 1; j < numSamples; j++)
+                for (int j = idx; j < numSamples; j++)
                 {
                     speakerOutput[j] = 0.0f;
                 }
 
-                return;
+                return;
+            }
+        }
+        #endif /* !QUICKTUNE_ADAPTIVE_ANALYSIS */
+    }
+}
+
+void QuickTune_ControlTask(void)
+{
+    uint8_t event;
+
+    // Deliver ISR-raised host events first, so band completions posted
+    // during the pass reach the handler before the pass-complete
+    // transitions dispatched below
+    uint32_t tail = s_event_queue_tail;
+    while (tail != s_event_queue_head)
+    {
+        const uint16_t packed = s_event_queue[tail & (QUICKTUNE_EVENT_QUEUE_LEN - 1)];
+        QUICKTUNE_COMPILER_BARRIER();
+        s_event_queue_tail = ++tail;
+        Event_Dispatch((QuickTuneEventType)(packed >> 8), packed & 0xFFu);
+    }
+
+    while (CtrlQueue_Pop(&event))
+    {
+        if (event == QT_CTRL_EVENT_PASS_COMPLETE &&
+            s_state == QUICKTUNE_STATE_COMPUTING)
+        {
+            // Multi-position: fold this pass into the spatial average
+            // and park for the next mic position if more are needed
+            if (MultiPosition_OnPassComplete())
+            {
+                continue;
             }
+
+            // Gain computation and the ten EQ10 redesigns run here at
+            // main-loop priority; the ISR sees only the resulting state
+            // transition and the published coefficient bank
+            ComputeCorrectionGains();
+            ApplyCorrectionGains();
+        }
+        else if (event == QT_CTRL_EVENT_APPLY_COMPLETE &&
+                 s_state == QUICKTUNE_STATE_APPLYING)
+        {
+            ApplyComplete();
         }
+        #if QUICKTUNE_DIAG_CAPTURE
+        else if (event == QT_CTRL_EVENT_DIAG_WINDOW)
+        {
+            // No state guard: a window snapshotted just before the pass
+            // completed is still worth its record
+            DiagCapture_EmitRecord();
+        }
+        #endif
     }
-    else if (s_state == QUICKTUNE_STATE_COMPUTING)
-    {
-        // Compute correction gains
-        ComputeCorrectionGains();
+}
 
-        // Output silence
-        memset(speakerOutput, 0, numSamples * sizeof(float));
-    }
-    else if (s_state == QUICKTUNE_STATE_APPLYING)
-    {
-        // Apply correction gains
-        ApplyCorrectionGains();
+void QuickTune_ProcessBlock(float* micInput, float* speakerOutput, int numSamples)
+{
+    #if QUICKTUNE_ENABLE_PROFILING
+    // Attribute the cost to the state at block entry
+    const QuickTuneState entry_state = s_state;
+    const uint32_t prof_t0 = QTProf_Cycles();
+    #endif
 
-        // Output silence
-        memset(speakerOutput, 0, numSamples * sizeof(float));
-    }
+    QuickTune_ProcessBlockImpl(micInput, speakerOutput, numSamples);
+
+    #if QUICKTUNE_ENABLE_PROFILING
+    QTProf_Update(&s_prof_by_state[entry_state], QTProf_Cycles() - prof_t0);
+    #endif
 }
 
 QuickTuneState QuickTune_GetState(void)
@@ -456,9 +2595,10 @@ QuickTuneState QuickTune_GetState(void)
 
 int QuickTune_GetCurrentBand(void)
 {
-    if (s_state == QUICKTUNE_STATE_MEASURING)
+    if (s_state == QUICKTUNE_STATE_MEASURING && s_mode == QUICKTUNE_MODE_SEQUENTIAL &&
+        s_current_band < QUICKTUNE_NUM_BANDS)
     {
-        return s_current_band;
+        return CurrentBand();
     }
     return -1;
 }
@@ -473,12 +2613,32 @@ float QuickTune_GetProgress(void)
     {
         return 1.0f;
     }
+    else if (s_state == QUICKTUNE_STATE_WAITING_POSITION)
+    {
+        // Between multi-position passes
+        return (float)s_mp_done / (float)s_mp_total;
+    }
+    else if (s_state == QUICKTUNE_STATE_MEASURING && s_mode == QUICKTUNE_MODE_PARALLEL)
+    {
+        // Progress through the single multi-tone pass
+        return (float)s_sample_counter / (float)QUICKTUNE_PARALLEL_TOTAL_SAMPLES;
+    }
+    else if (s_state == QUICKTUNE_STATE_MEASURING && s_mode == QUICKTUNE_MODE_SWEEP)
+    {
+        // Progress through the sweep
+        return (float)s_sample_counter / (float)QUICKTUNE_SWEEP_TOTAL_SAMPLES;
+    }
     else if (s_state == QUICKTUNE_STATE_MEASURING)
     {
-        // Progress through bands
+        // Progress through bands. With the adaptive controller the
+        // per-tone duration is not fixed, so cap the within-band part.
         const float num_bands_f = (float)QUICKTUNE_NUM_BANDS;
         const float band_progress = (float)s_current_band / num_bands_f;
-        const float sample_progress = (float)s_sample_counter / (float)QUICKTUNE_TONE_TOTAL_SAMPLES;
+        float sample_progress = (float)s_sample_counter / (float)QUICKTUNE_TONE_TOTAL_SAMPLES;
+        if (sample_progress > 1.0f)
+        {
+            sample_progress = 1.0f;
+        }
         return band_progress + sample_progress / num_bands_f;
     }
     else
@@ -509,9 +2669,14 @@ const float* QuickTune_GetMeasuredLevels(void)
 void QuickTune_Stop(void)
 {
     s_state = QUICKTUNE_STATE_IDLE;
+    Event_Dispatch(QUICKTUNE_EVENT_STATE_CHANGE, QUICKTUNE_STATE_IDLE);
     s_current_band = 0;
     s_sample_counter = 0;
     s_iteration = 0;
+    s_mp_total = 0;
+    s_mp_done = 0;
+    BatchDisable();
+    s_partial_mask = 0;
 }
 
 void QuickTune_ApplyGains(const float* gains)
@@ -519,6 +2684,7 @@ void QuickTune_ApplyGains(const float* gains)
     if (gains == NULL)
     {
         s_last_error = 3;  // Invalid parameters
+        Event_Dispatch(QUICKTUNE_EVENT_ERROR, 3);
         return;
     }
 
@@ -531,27 +2697,500 @@ void QuickTune_ApplyGains(const float* gains)
     s_last_error = 0;
 }
 
+bool QuickTune_RunOffline(QuickTuneMode mode, const float* micCapture,
+                          int numSamples, float* gainsOut)
+{
+    if (micCapture == NULL || gainsOut == NULL || numSamples <= 0)
+    {
+        s_last_error = 3;  // Invalid parameters
+        Event_Dispatch(QUICKTUNE_EVENT_ERROR, 3);
+        return false;
+    }
+
+    if (!QuickTune_Start(mode))
+    {
+        return false;  // Not IDLE; error code already set
+    }
+
+    static float mic[QUICKTUNE_BLOCK_SIZE];
+    static float spk[QUICKTUNE_BLOCK_SIZE];
+
+    // Upper bound: the capture plus a 60 s silence tail. Every state
+    // consumes blocks monotonically, so a healthy run finishes well
+    // inside this; hitting the bound means the capture does not match
+    // the stimulus schedule (e.g. wrong mode).
+    int offset = 0;
+    long blocks_left = (long)(numSamples + QUICKTUNE_BLOCK_SIZE - 1) / QUICKTUNE_BLOCK_SIZE
+                       + 60L * QUICKTUNE_SAMPLE_RATE / QUICKTUNE_BLOCK_SIZE;
+
+    while (s_state != QUICKTUNE_STATE_DONE && s_state != QUICKTUNE_STATE_ERROR)
+    {
+        if (blocks_left-- <= 0)
+        {
+            QuickTune_Stop();
+            s_last_error = 3;  // Capture/mode mismatch
+            Event_Dispatch(QUICKTUNE_EVENT_ERROR, 3);
+            return false;
+        }
+
+        // Next capture block, zero-padded past the end of the recording
+        int n = numSamples - offset;
+        if (n > QUICKTUNE_BLOCK_SIZE)
+        {
+            n = QUICKTUNE_BLOCK_SIZE;
+        }
+        if (n > 0)
+        {
+            memcpy(mic, &micCapture[offset], (size_t)n * sizeof(float));
+            offset += n;
+        }
+        if (n < QUICKTUNE_BLOCK_SIZE)
+        {
+            memset(&mic[(n > 0) ? n : 0], 0,
+                   (size_t)(QUICKTUNE_BLOCK_SIZE - ((n > 0) ? n : 0)) * sizeof(float));
+        }
+
+        // Same shipping block path as the live callback (including the
+        // profiling wrapper); the generated stimulus is discarded. The
+        // control task runs between blocks like the firmware main loop.
+        QuickTune_ProcessBlock(mic, spk, QUICKTUNE_BLOCK_SIZE);
+        QuickTune_ControlTask();
+    }
+
+    if (s_state != QUICKTUNE_STATE_DONE)
+    {
+        return false;  // ERROR state; error code already set
+    }
+
+    memcpy(gainsOut, s_cumulative_gains, sizeof(s_cumulative_gains));
+    s_last_error = 0;
+    return true;
+}
+
+/* ============================================================================
+ * BACKGROUND ROOM MONITORING
+ * ============================================================================ */
+
+void QuickTune_StartMonitoring(void)
+{
+    memset(&s_monitor_status, 0, sizeof(s_monitor_status));
+
+    // Per-band windows (whole cycles of fc) and Goertzel coefficients
+    // are constexpr tables (quicktune_tables.h), so the audio-path band
+    // rotation involves no transcendentals and start is a pair of copies
+    memcpy(s_monitor_windows, QTCT_MONITOR_WINDOWS.v, sizeof(s_monitor_windows));
+    memcpy(s_monitor_coeffs, QTCT_MONITOR_COEFFS.v, sizeof(s_monitor_coeffs));
+
+    s_monitor_band = 0;
+    s_monitor_counter = 0;
+    s_monitor_mic_s1 = 0.0f;
+    s_monitor_mic_s2 = 0.0f;
+    s_monitor_spk_s1 = 0.0f;
+    s_monitor_spk_s2 = 0.0f;
+
+    QUICKTUNE_COMPILER_BARRIER();
+    s_monitor_enabled = true;
+}
+
+void QuickTune_StopMonitoring(void)
+{
+    s_monitor_enabled = false;
+    memset(&s_monitor_status, 0, sizeof(s_monitor_status));
+}
+
+/**
+ * @brief Finalize one monitor window and rotate to the next band
+ *
+ * Accepts the window only if the speaker carried enough program energy
+ * at the band frequency; accepted transfers feed the exponential
+ * average and the drift detector.
+ */
+static void Monitor_FinalizeWindow(void)
+{
+    const int band = s_monitor_band;
+    const int num_samples = (int)s_monitor_windows[band];
+
+    const float spk_db = Goertzel_FinalizeLevel(s_monitor_spk_s1, s_monitor_spk_s2,
+                                                s_monitor_coeffs[band], num_samples);
+
+    if (spk_db > QUICKTUNE_MONITOR_MIN_LEVEL_DB)
+    {
+        const float mic_db = Goertzel_FinalizeLevel(s_monitor_mic_s1, s_monitor_mic_s2,
+                                                    s_monitor_coeffs[band], num_samples);
+        const float transfer = mic_db - spk_db + QUICKTUNE_MEMS_CALIBRATION[band];
+
+        if (s_monitor_status.update_count[band] == 0)
+        {
+            s_monitor_status.transfer_db[band] = transfer;
+        }
+        else
+        {
+            s_monitor_status.transfer_db[band] +=
+                QUICKTUNE_MONITOR_ALPHA * (transfer - s_monitor_status.transfer_db[band]);
+        }
+
+        if (s_monitor_status.update_count[band] < 0xFFFF)
+        {
+            s_monitor_status.update_count[band]++;
+        }
+
+        if (s_monitor_status.update_count[band] == QUICKTUNE_MONITOR_REF_UPDATES)
+        {
+            s_monitor_status.reference_db[band] = s_monitor_status.transfer_db[band];
+        }
+        else if (s_monitor_status.update_count[band] > QUICKTUNE_MONITOR_REF_UPDATES)
+        {
+            const float deviation = s_monitor_status.transfer_db[band] -
+                                    s_monitor_status.reference_db[band];
+            if (fabsf(deviation) > QUICKTUNE_MONITOR_DRIFT_DB)
+            {
+                s_monitor_status.drift_mask |= (uint16_t)(1u << band);
+            }
+            else
+            {
+                s_monitor_status.drift_mask &= (uint16_t)~(1u << band);
+            }
+            s_monitor_status.drift_detected = (s_monitor_status.drift_mask != 0);
+        }
+    }
+
+    // Rotate to the next band
+    s_monitor_band = (band + 1) % QUICKTUNE_NUM_BANDS;
+    s_monitor_counter = 0;
+    s_monitor_mic_s1 = 0.0f;
+    s_monitor_mic_s2 = 0.0f;
+    s_monitor_spk_s1 = 0.0f;
+    s_monitor_spk_s2 = 0.0f;
+}
+
+void QuickTune_MonitorProcessBlock(const float* micInput, const float* speakerOutput,
+                                   int numSamples)
+{
+    // Inactive while disabled or while a calibration owns the detectors
+    if (!s_monitor_enabled ||
+        !(s_state == QUICKTUNE_STATE_IDLE || s_state == QUICKTUNE_STATE_DONE))
+    {
+        return;
+    }
+
+    int idx = 0;
+    while (idx < numSamples)
+    {
+        const int band = s_monitor_band;
+        int seg = (int)(s_monitor_windows[band] - s_monitor_counter);
+        if (seg > numSamples - idx)
+        {
+            seg = numSamples - idx;
+        }
+
+        // One detector pair on the active band only: ~8 cycles/sample
+        // regardless of band count
+        const float coeff = s_monitor_coeffs[band];
+        float m1 = s_monitor_mic_s1, m2 = s_monitor_mic_s2;
+        float r1 = s_monitor_spk_s1, r2 = s_monitor_spk_s2;
+
+        for (int i = 0; i < seg; i++)
+        {
+            const float m0 = coeff * m1 - m2 + micInput[idx + i];
+            m2 = m1;
+            m1 = m0;
+
+            const float r0 = coeff * r1 - r2 + speakerOutput[idx + i];
+            r2 = r1;
+            r1 = r0;
+        }
+
+        s_monitor_mic_s1 = m1;
+        s_monitor_mic_s2 = m2;
+        s_monitor_spk_s1 = r1;
+        s_monitor_spk_s2 = r2;
+
+        s_monitor_counter += (uint32_t)seg;
+        idx += seg;
+
+        if (s_monitor_counter >= s_monitor_windows[band])
+        {
+            Monitor_FinalizeWindow();
+        }
+    }
+}
+
+bool QuickTune_GetMonitorStatus(QuickTuneMonitorStatus* status)
+{
+    if (status == NULL)
+    {
+        return false;
+    }
+
+    *status = s_monitor_status;
+    return true;
+}
+
+/**
+ * @brief CRC32 (IEEE 802.3, bitwise)
+ *
+ * Table-free variant - presets are read once at boot and written once
+ * per calibration, so the bitwise loop is not worth 1 KB of table.
+ *
+ * @param data Input bytes
+ * @param length Number of bytes
+ * @return CRC32 value
+ */
+static uint32_t Preset_Crc32(const uint8_t* data, uint32_t length)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+
+    return crc ^ 0xFFFFFFFFu;
+}
+
+bool QuickTune_SavePreset(void* buf)
+{
+    if (buf == NULL)
+    {
+        s_last_error = 3;  // Invalid parameters
+        Event_Dispatch(QUICKTUNE_EVENT_ERROR, 3);
+        return false;
+    }
+
+    QuickTunePreset preset;
+    preset.magic = QUICKTUNE_PRESET_MAGIC;
+    preset.version = QUICKTUNE_PRESET_VERSION;
+    preset.size = (uint16_t)sizeof(QuickTunePreset);
+
+    EQ10_GetCoefficients(preset.coeffs);
+    memcpy(preset.gains, s_cumulative_gains, sizeof(preset.gains));
+
+    preset.crc = Preset_Crc32((const uint8_t*)&preset,
+                              offsetof(QuickTunePreset, crc));
+
+    // memcpy out - buf may be unaligned
+    memcpy(buf, &preset, sizeof(preset));
+
+    s_last_error = 0;
+    return true;
+}
+
+bool QuickTune_LoadPreset(const void* buf)
+{
+    if (buf == NULL)
+    {
+        s_last_error = 3;  // Invalid parameters
+        Event_Dispatch(QUICKTUNE_EVENT_ERROR, 3);
+        return false;
+    }
+
+    // memcpy in - buf may be unaligned (e.g. memory-mapped flash)
+    QuickTunePreset preset;
+    memcpy(&preset, buf, sizeof(preset));
+
+    if (preset.magic != QUICKTUNE_PRESET_MAGIC ||
+        preset.version != QUICKTUNE_PRESET_VERSION ||
+        preset.size != sizeof(QuickTunePreset) ||
+        preset.crc != Preset_Crc32((const uint8_t*)&preset,
+                                   offsetof(QuickTunePreset, crc)))
+    {
+        s_last_error = 4;  // Preset validation failed
+        Event_Dispatch(QUICKTUNE_EVENT_ERROR, 4);
+        return false;
+    }
+
+    // Direct coefficient restore - no filter redesign, no transcendentals
+    EQ10_SetCoefficients(preset.coeffs);
+    memcpy(s_cumulative_gains, preset.gains, sizeof(s_cumulative_gains));
+
+    s_last_error = 0;
+    return true;
+}
+
 int QuickTune_GetLastError(void)
 {
     return s_last_error;
 }
 
-float QuickTune_GetCpuUsage(void)
+bool QuickTune_GetMeasurementDiag(QuickTuneMeasureDiag* diag)
 {
-    // Estimate based on profiling
-    // During calibration: ~0.13% CPU (tone + Goertzel)
-    // Post-calibration: ~3.8% CPU (EQ10 processing)
+    #if QUICKTUNE_ADAPTIVE_ANALYSIS
+    if (diag == NULL || !s_measure_diag_valid)
+    {
+        return false;
+    }
 
-    if (s_state == QUICKTUNE_STATE_MEASURING)
+    *diag = s_measure_diag;
+    return true;
+    #else
+    (void)diag;
+    return false;
+    #endif
+}
+
+bool QuickTune_GetHarmonicLevels(QuickTuneHarmonicLevels* levels)
+{
+    #if QUICKTUNE_ADAPTIVE_ANALYSIS && QUICKTUNE_HARMONIC_CAPTURE
+    if (levels == NULL || s_harmonic_levels.valid_mask == 0)
     {
-        return 0.13f;
+        return false;
     }
-    else if (s_state == QUICKTUNE_STATE_DONE)
+
+    *levels = s_harmonic_levels;
+    return true;
+    #else
+    (void)levels;
+    return false;
+    #endif
+}
+
+uint32_t QuickTune_GetDiagnosticsSize(void)
+{
+    #if QUICKTUNE_DIAG_CAPTURE
+    return s_diag_total;
+    #else
+    return 0;
+    #endif
+}
+
+int QuickTune_ReadDiagnostics(uint32_t offset, void* buf, int len)
+{
+    #if QUICKTUNE_DIAG_CAPTURE
+    if (buf == NULL || len <= 0)
+    {
+        s_last_error = 3;  // Invalid parameters
+        Event_Dispatch(QUICKTUNE_EVENT_ERROR, 3);
+        return -1;
+    }
+
+    const uint32_t total = s_diag_total;
+    if (offset >= total)
+    {
+        return 0;
+    }
+
+    // Oldest byte still resident in the ring
+    const uint32_t oldest = (total > QUICKTUNE_DIAG_RING_BYTES)
+                                ? total - QUICKTUNE_DIAG_RING_BYTES
+                                : 0;
+    if (offset < oldest)
+    {
+        s_last_error = 3;  // Invalid parameters (already overwritten)
+        Event_Dispatch(QUICKTUNE_EVENT_ERROR, 3);
+        return -1;
+    }
+
+    uint32_t count = total - offset;
+    if (count > (uint32_t)len)
+    {
+        count = (uint32_t)len;
+    }
+
+    uint8_t* out = (uint8_t*)buf;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        out[i] = s_diag_ring[(offset + i) % QUICKTUNE_DIAG_RING_BYTES];
+    }
+
+    return (int)count;
+    #else
+    (void)offset;
+    (void)buf;
+    (void)len;
+    return -1;
+    #endif
+}
+
+float QuickTune_GetCpuUsage(void)
+{
+    #if QUICKTUNE_ENABLE_PROFILING
+    // Derive from measured cycles: the QuickTune path while calibrating,
+    // the EQ10 cascade once correction is active
+    const QTProf_Counter* counter = NULL;
+    QTProf_Counter eq10_counter;
+
+    if (s_state == QUICKTUNE_STATE_DONE || s_state == QUICKTUNE_STATE_IDLE)
     {
-        return 3.8f;
+        EQ10_GetProfile(&eq10_counter);
+        counter = &eq10_counter;
     }
     else
+    {
+        counter = &s_prof_by_state[s_state];
+    }
+
+    if (counter->count == 0)
     {
         return 0.0f;
     }
+
+    const float avg_cycles = (float)(counter->total_cycles / counter->count);
+    return 100.0f * avg_cycles / (float)QUICKTUNE_CYCLES_PER_BLOCK;
+    #else
+    return 0.0f;
+    #endif
+}
+
+bool QuickTune_GetPerfStats(QuickTunePerfStats* stats)
+{
+    #if QUICKTUNE_ENABLE_PROFILING
+    if (stats == NULL)
+    {
+        return false;
+    }
+
+    uint32_t wcet = 0;
+
+    for (int state = 0; state < QUICKTUNE_NUM_STATES; state++)
+    {
+        const QTProf_Counter* c = &s_prof_by_state[state];
+        QuickTunePerfBucket* b = &stats->process_by_state[state];
+
+        b->min_cycles = (c->count > 0) ? c->min_cycles : 0;
+        b->max_cycles = c->max_cycles;
+        b->avg_cycles = (c->count > 0) ? (uint32_t)(c->total_cycles / c->count) : 0;
+        b->block_count = c->count;
+
+        if (c->max_cycles > wcet)
+        {
+            wcet = c->max_cycles;
+        }
+    }
+
+    QTProf_Counter eq10_counter;
+    EQ10_GetProfile(&eq10_counter);
+
+    stats->eq10_block.min_cycles = (eq10_counter.count > 0) ? eq10_counter.min_cycles : 0;
+    stats->eq10_block.max_cycles = eq10_counter.max_cycles;
+    stats->eq10_block.avg_cycles = (eq10_counter.count > 0)
+        ? (uint32_t)(eq10_counter.total_cycles / eq10_counter.count) : 0;
+    stats->eq10_block.block_count = eq10_counter.count;
+
+    if (eq10_counter.max_cycles > wcet)
+    {
+        wcet = eq10_counter.max_cycles;
+    }
+
+    stats->wcet_cycles = wcet;
+
+    return true;
+    #else
+    (void)stats;
+    return false;
+    #endif
+}
+
+void QuickTune_ResetPerfStats(void)
+{
+    #if QUICKTUNE_ENABLE_PROFILING
+    for (int state = 0; state < QUICKTUNE_NUM_STATES; state++)
+    {
+        QTProf_Reset(&s_prof_by_state[state]);
+    }
+    EQ10_ResetProfile();
+    #endif
 }
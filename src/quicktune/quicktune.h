@@ -42,9 +42,22 @@ typedef enum {
     QUICKTUNE_STATE_COMPUTING,  /**< Computing correction gains */
     QUICKTUNE_STATE_APPLYING,   /**< Applying correction to EQ10 */
     QUICKTUNE_STATE_DONE,       /**< Calibration complete */
-    QUICKTUNE_STATE_ERROR       /**< Error occurred */
+    QUICKTUNE_STATE_ERROR,      /**< Error occurred */
+    QUICKTUNE_STATE_WAITING_POSITION  /**< Waiting for the mic to be moved (multi-position) */
 } QuickTuneState;
 
+/** Number of state machine states (sizes the per-state statistics) */
+#define QUICKTUNE_NUM_STATES        7
+
+/**
+ * @brief Calibration measurement mode
+ */
+typedef enum {
+    QUICKTUNE_MODE_PARALLEL,    /**< Multi-tone stimulus, all bands measured at once (default, ~1.2 s) */
+    QUICKTUNE_MODE_SEQUENTIAL,  /**< Stepped single tones, one band at a time (fallback, ~9 s) */
+    QUICKTUNE_MODE_SWEEP        /**< Logarithmic sweep, all bands extracted in one pass (~0.7 s/iteration) */
+} QuickTuneMode;
+
 /* ============================================================================
  * PUBLIC API
  * ============================================================================ */
@@ -61,16 +74,22 @@ void QuickTune_Init(void);
  * @brief Start room calibration
  *
  * Begins the QuickTune calibration sequence:
- * 1. Play tones at each EQ10 band frequency
+ * 1. Play test tones at the EQ10 band frequencies
  * 2. Measure room response using Goertzel
  * 3. Compute correction gains
  * 4. Apply correction to EQ10
  *
- * Total calibration time: ~3 seconds (300 ms × 10 bands)
+ * In QUICKTUNE_MODE_PARALLEL (default fast mode) all 10 band tones are
+ * played as one crest-factor-optimized multi-tone stimulus and measured
+ * by a bank of 10 concurrent Goertzel detectors: ~400 ms per iteration,
+ * ~1.2 s total. In QUICKTUNE_MODE_SEQUENTIAL each band is stepped through
+ * individually: ~3 s per iteration, ~9 s total.
+ *
+ * @param mode Measurement mode (QUICKTUNE_MODE_PARALLEL recommended)
  *
  * @return true if calibration started successfully, false if already running
  */
-bool QuickTune_Start(void);
+bool QuickTune_Start(QuickTuneMode mode);
 
 /**
  * @brief Process one audio block during calibration
@@ -83,6 +102,11 @@ bool QuickTune_Start(void);
  *
  * When not calibrating (IDLE state), this function does nothing.
  *
+ * Only sample-rate work runs here (tone generation, Goertzel analysis,
+ * state capture); gain computation and filter redesign are deferred to
+ * QuickTune_ControlTask(), so the worst-case ISR cost is flat across
+ * all calibration states.
+ *
  * @param micInput Microphone input buffer (read-only, float32)
  * @param speakerOutput Speaker output buffer (write, float32)
  * @param numSamples Number of samples in buffers (typically 32)
@@ -92,6 +116,23 @@ bool QuickTune_Start(void);
  */
 void QuickTune_ProcessBlock(float* micInput, float* speakerOutput, int numSamples);
 
+/**
+ * @brief Run deferred control-rate work (call from the main loop)
+ *
+ * Drains the completion events posted by QuickTune_ProcessBlock() and
+ * performs the control-rate stages of calibration: spatial-average
+ * merging, correction gain computation and the ten EQ10 filter
+ * redesigns (powf/sinf/cosf). Keeping this out of the audio ISR removes
+ * the worst-case block that caused I2S underruns when COMPUTING and
+ * APPLYING ran at interrupt priority.
+ *
+ * Call regularly from the main loop (any rate down to a few hundred Hz
+ * is fine - the state machine simply pauses in COMPUTING until the next
+ * call). Must be the only caller of control-rate work: the ISR/control
+ * split is single-producer/single-consumer.
+ */
+void QuickTune_ControlTask(void);
+
 /**
  * @brief Get current calibration state
  *
@@ -102,9 +143,10 @@ QuickTuneState QuickTune_GetState(void);
 /**
  * @brief Get current band being measured (0-9)
  *
- * Valid only during MEASURING state.
+ * Valid only during MEASURING state in sequential mode. In parallel mode
+ * all bands are measured at once and this returns -1.
  *
- * @return Band index (0-9), or -1 if not measuring
+ * @return Band index (0-9), or -1 if not measuring sequentially
  */
 int QuickTune_GetCurrentBand(void);
 
@@ -158,6 +200,367 @@ void QuickTune_Stop(void);
  */
 void QuickTune_ApplyGains(const float* gains);
 
+/**
+ * @brief Run a full calibration offline against a recorded mic capture
+ *
+ * Drives the same state machine, tone generator and Goertzel code as
+ * the live path, but in a tight loop decoupled from the audio callback:
+ * micCapture is consumed block by block in place of the live mic, and
+ * the generated stimulus is discarded. A full calibration replays in
+ * milliseconds on host (see make bench) or tens of milliseconds on
+ * target, so algorithm changes can be validated against the recorded
+ * room library with the shipping C++ instead of the Python re-derivation.
+ *
+ * The capture must start at calibration start and must have been
+ * recorded in the same measurement mode (the stimulus timing has to
+ * line up with what the state machine plays). If the capture is shorter
+ * than the calibration, the remainder is fed as silence.
+ *
+ * Must be called from the control task while IDLE, never concurrently
+ * with live QuickTune_ProcessBlock() calls. Leaves the state machine in
+ * DONE on success, so GetMeasuredLevels()/GetCorrectionGains() and
+ * SavePreset() work as after a live calibration.
+ *
+ * @param mode Measurement mode the capture was recorded in
+ * @param micCapture Recorded microphone samples (float32, 48 kHz)
+ * @param numSamples Number of samples in micCapture
+ * @param gainsOut Output: 10 correction gains (dB)
+ *
+ * @return true on success, false on invalid parameters / wrong state /
+ *         calibration not completing within the capture plus a 60 s
+ *         silence tail
+ */
+bool QuickTune_RunOffline(QuickTuneMode mode, const float* micCapture,
+                          int numSamples, float* gainsOut);
+
+/* ============================================================================
+ * MULTI-POSITION CALIBRATION
+ * ============================================================================ */
+
+/**
+ * @brief Start a multi-position (spatial averaging) calibration
+ *
+ * Correction tuned at a single mic position can make other listening
+ * spots worse. Multi-position mode measures the room at numPositions
+ * mic placements and computes the correction from the weighted
+ * power-domain average of the per-position responses.
+ *
+ * Flow: the first measurement pass runs immediately; after each pass
+ * the response is merged into the running average (O(bands) memory
+ * regardless of position count) and the state machine parks in
+ * QUICKTUNE_STATE_WAITING_POSITION. Move the microphone, then call
+ * QuickTune_ConfirmPosition() for the next pass. After the last
+ * position the normal compute/apply/iterate sequence runs against the
+ * averaged response, with the refinement iterations measured at the
+ * final mic position - so each extra position costs one measurement
+ * pass, not a full iteration sequence.
+ *
+ * @param mode Measurement mode (QUICKTUNE_MODE_PARALLEL recommended)
+ * @param numPositions Number of mic positions (1 to QUICKTUNE_MAX_POSITIONS;
+ *                     1 behaves exactly like QuickTune_Start())
+ * @param weights Per-position weights (> 0), or NULL for equal weighting.
+ *                Weight the sweet spot higher to bias the compromise.
+ *
+ * @return true if calibration started, false if already running or
+ *         invalid parameters
+ */
+bool QuickTune_StartMultiPosition(QuickTuneMode mode, int numPositions,
+                                  const float* weights);
+
+/**
+ * @brief Confirm the mic has been moved to the next position
+ *
+ * Call while in QUICKTUNE_STATE_WAITING_POSITION to start the next
+ * measurement pass.
+ *
+ * @return true if the next pass started, false if not waiting
+ */
+bool QuickTune_ConfirmPosition(void);
+
+/**
+ * @brief Get the number of positions measured so far
+ *
+ * @return Completed measurement positions of the current/last
+ *         multi-position calibration (0 for single-position runs)
+ */
+int QuickTune_GetPositionsMeasured(void);
+
+/* ============================================================================
+ * BATCH CALIBRATION (PRODUCTION LINE)
+ * ============================================================================ */
+
+/**
+ * @brief Start a calibration coordinated with other units on the line
+ *
+ * End-of-line test cells calibrate several monitors at once over one
+ * shared controller. Concurrent sequential calibrations normally
+ * crosstalk - every unit's Goertzel detector hears every unit's tone -
+ * so batch mode deconflicts them in frequency: each unit measures the
+ * 10 bands in an order rotated by its unitIndex, and every band slot is
+ * padded with silence to a fixed length (QUICKTUNE_BATCH_SLOT_SAMPLES),
+ * keeping all units' band schedules in lockstep. Units sharing a time
+ * slot are then always stimulating disjoint band frequencies, whose
+ * tones fall outside each other's analysis bins. Supports up to
+ * QUICKTUNE_NUM_BANDS concurrent units.
+ *
+ * The controller must start all units within one audio block of each
+ * other (a broadcast start over the line bus). Units stay sample-locked
+ * within a measurement pass; the small drift the control task introduces
+ * between iteration passes is negligible against the 600 ms slot.
+ *
+ * Always runs in sequential mode: the parallel and sweep stimuli excite
+ * all bands at once and cannot be deconflicted. Everything else behaves
+ * like QuickTune_Start(QUICKTUNE_MODE_SEQUENTIAL); a subsequent plain
+ * start clears the batch configuration. Poll cheaply with
+ * QuickTune_GetStatusWord().
+ *
+ * @param unitIndex This unit's index on the line (0 to numUnits-1)
+ * @param numUnits Number of units calibrating concurrently
+ *                 (1 to QUICKTUNE_NUM_BANDS)
+ *
+ * @return true if calibration started, false if already running or
+ *         invalid parameters
+ */
+bool QuickTune_StartBatch(int unitIndex, int numUnits);
+
+/* Status word layout (see QuickTune_GetStatusWord()) */
+#define QUICKTUNE_STATUS_STATE_SHIFT    0   /**< [3:0]  QuickTuneState */
+#define QUICKTUNE_STATUS_STATE_MASK     0x0000000Fu
+#define QUICKTUNE_STATUS_BAND_SHIFT     4   /**< [7:4]  Band being measured */
+#define QUICKTUNE_STATUS_BAND_MASK      0x000000F0u
+#define QUICKTUNE_STATUS_ITER_SHIFT     8   /**< [11:8] Iteration pass */
+#define QUICKTUNE_STATUS_ITER_MASK      0x00000F00u
+#define QUICKTUNE_STATUS_ERROR_SHIFT    12  /**< [15:12] Last error code */
+#define QUICKTUNE_STATUS_ERROR_MASK     0x0000F000u
+#define QUICKTUNE_STATUS_PROGRESS_SHIFT 16  /**< [23:16] Progress, 0-255 = 0-100% */
+#define QUICKTUNE_STATUS_PROGRESS_MASK  0x00FF0000u
+#define QUICKTUNE_STATUS_POS_SHIFT      24  /**< [27:24] Positions measured */
+#define QUICKTUNE_STATUS_POS_MASK       0x0F000000u
+
+/** Band field value when no band is being measured (parallel mode, idle) */
+#define QUICKTUNE_STATUS_BAND_NONE      0xFu
+
+/** Any band of the last pass was measured low-confidence */
+#define QUICKTUNE_STATUS_FLAG_LOW_CONF  (1u << 28)
+
+/** An EQ10 coefficient ramp is in flight */
+#define QUICKTUNE_STATUS_FLAG_RAMPING   (1u << 29)
+
+/** Batch (multi-unit) calibration is configured */
+#define QUICKTUNE_STATUS_FLAG_BATCH     (1u << 30)
+
+/**
+ * @brief Get the full calibration status packed into one 32-bit word
+ *
+ * Single-read snapshot of state, current band, iteration, error code,
+ * progress and flags (layout above) for cheap polling over a slow
+ * control bus - one register read per poll instead of five getter
+ * round-trips. The band field holds the physical band index being
+ * measured (after any batch rotation), or QUICKTUNE_STATUS_BAND_NONE.
+ *
+ * @return Packed status word
+ */
+uint32_t QuickTune_GetStatusWord(void);
+
+/* ============================================================================
+ * EVENT CALLBACKS
+ * ============================================================================ */
+
+/** Event types delivered to the registered callback */
+typedef enum {
+    QUICKTUNE_EVENT_STATE_CHANGE = 1,       /**< data = new QuickTuneState */
+    QUICKTUNE_EVENT_BAND_COMPLETE = 2,      /**< data = physical band index */
+    QUICKTUNE_EVENT_ITERATION_COMPLETE = 3, /**< data = iteration just finished */
+    QUICKTUNE_EVENT_ERROR = 4               /**< data = error code (see QuickTune_GetLastError) */
+} QuickTuneEventType;
+
+/** Event callback signature */
+typedef void (*QuickTuneEventCallback)(QuickTuneEventType type, uint32_t data,
+                                       void* context);
+
+/**
+ * @brief Register a callback for calibration events
+ *
+ * Event-driven alternative to polling QuickTune_GetState() /
+ * QuickTune_GetProgress() from the main loop: the host can sleep
+ * through the settling windows and wake on interrupt, with the
+ * callback covering every observable transition.
+ *
+ * The callback always runs in the control context, never in the audio
+ * ISR - events raised by the measurement ISR are posted through a
+ * lock-free queue and delivered from QuickTune_ControlTask(), while
+ * events raised by API calls (start transitions, rejections) fire
+ * inside the call itself. Handlers may therefore do slow work (flash
+ * writes, logging) but must not call back into the audio path.
+ *
+ * Error events fire whenever an API call is rejected and sets the
+ * error code; a cleared error (successful call) raises no event.
+ *
+ * Pass NULL to unregister. Registering drops any undelivered events
+ * from a previous handler. QuickTune_Init() unregisters the callback.
+ *
+ * @param callback Callback function (NULL to unregister)
+ * @param context Opaque pointer passed through to the callback
+ */
+void QuickTune_SetEventCallback(QuickTuneEventCallback callback, void* context);
+
+/* ============================================================================
+ * DIFFERENTIAL RECALIBRATION
+ * ============================================================================ */
+
+/**
+ * @brief Start a partial recalibration of selected bands only
+ *
+ * Touch-up mode for small room changes (furniture moved, port blocked):
+ * measures only the bands set in the mask and leaves every other band's
+ * stored level and correction untouched - typically a couple of bass
+ * bands in well under a second, against ~9 s for a full three-iteration
+ * run. The remeasured corrections are applied per band through
+ * EQ10_SetBandGain(), so the untouched biquads are never redesigned,
+ * and no refinement iterations run (a touch-up adjusts from an
+ * already-converged calibration).
+ *
+ * Sequential mode only; intended after a completed calibration or a
+ * loaded preset. A full QuickTune_Start() clears the mask.
+ *
+ * @param bandMask Bit per band to remeasure (bit 0 = 25 Hz ... bit 9 =
+ *                 1600 Hz); must be non-zero with no bits above band 9
+ *
+ * @return true if started, false if not IDLE or the mask is invalid
+ */
+bool QuickTune_StartPartial(uint16_t bandMask);
+
+/* ============================================================================
+ * PRESET PERSISTENCE
+ * ============================================================================ */
+
+/** Preset blob magic number ('QTPR') */
+#define QUICKTUNE_PRESET_MAGIC      0x51545052u
+
+/** Preset blob format version */
+#define QUICKTUNE_PRESET_VERSION    1
+
+/**
+ * @brief Calibration preset blob
+ *
+ * Self-contained binary format for flash storage: versioned header,
+ * the 50 precomputed biquad coefficients, the 10 correction gains, and
+ * a CRC32 over everything before the crc field. All fields are 32-bit
+ * aligned; total size is 252 bytes.
+ *
+ * Restoring goes through EQ10_SetCoefficients() directly - no
+ * powf/sinf/cosf at boot - so correction is active within the first
+ * audio block after the flash read.
+ */
+typedef struct
+{
+    uint32_t magic;                     /**< QUICKTUNE_PRESET_MAGIC */
+    uint16_t version;                   /**< QUICKTUNE_PRESET_VERSION */
+    uint16_t size;                      /**< sizeof(QuickTunePreset) */
+    float coeffs[QUICKTUNE_EQ10_COEFF_SIZE];  /**< Normalized biquad coefficients */
+    float gains[QUICKTUNE_NUM_BANDS];   /**< Correction gains (dB) */
+    uint32_t crc;                       /**< CRC32 of all preceding bytes */
+} QuickTunePreset;
+
+/** Preset blob size (bytes) - for sizing the flash slot */
+#define QUICKTUNE_PRESET_SIZE       sizeof(QuickTunePreset)
+
+/**
+ * @brief Save the current calibration as a preset blob
+ *
+ * Captures the live EQ10 coefficients and correction gains into buf.
+ * Valid after calibration completes or after QuickTune_ApplyGains().
+ *
+ * @param buf Output buffer, at least QUICKTUNE_PRESET_SIZE bytes
+ *            (no alignment requirement)
+ *
+ * @return true if saved, false on invalid buffer
+ */
+bool QuickTune_SavePreset(void* buf);
+
+/**
+ * @brief Restore calibration from a preset blob
+ *
+ * Validates magic, version, size and CRC, then applies the stored
+ * coefficients via the direct EQ10_SetCoefficients() path - zero
+ * transcendental math, safe to call before the amp unmutes.
+ *
+ * @param buf Preset blob, QUICKTUNE_PRESET_SIZE bytes
+ *            (no alignment requirement, e.g. memory-mapped flash)
+ *
+ * @return true if restored, false if validation failed (error code 4)
+ */
+bool QuickTune_LoadPreset(const void* buf);
+
+/* ============================================================================
+ * BACKGROUND ROOM MONITORING
+ * ============================================================================ */
+
+/**
+ * @brief Background monitoring status
+ */
+typedef struct
+{
+    /** Smoothed per-band room transfer, mic vs speaker, MEMS-corrected (dB) */
+    float transfer_db[QUICKTUNE_NUM_BANDS];
+
+    /** Reference transfer latched after the first accepted measurements (dB) */
+    float reference_db[QUICKTUNE_NUM_BANDS];
+
+    /** Accepted measurement windows per band (saturates at 65535) */
+    uint16_t update_count[QUICKTUNE_NUM_BANDS];
+
+    /** Bit per band: transfer deviates from the reference beyond threshold */
+    uint16_t drift_mask;
+
+    /** Any band drifting - a quiet moment recalibration is advisable */
+    bool drift_detected;
+} QuickTuneMonitorStatus;
+
+/**
+ * @brief Start background room monitoring
+ *
+ * Enables continuous per-band transfer estimation on program material
+ * (see QuickTune_MonitorProcessBlock()). Typically called right after a
+ * calibration completes; the first accepted measurements establish the
+ * reference the drift detector compares against.
+ */
+void QuickTune_StartMonitoring(void);
+
+/**
+ * @brief Stop background room monitoring
+ *
+ * Disables monitoring and clears all accumulated estimates.
+ */
+void QuickTune_StopMonitoring(void);
+
+/**
+ * @brief Feed one playback block to the background monitor
+ *
+ * Call from the audio loop during normal playback with the mic input
+ * and the signal actually sent to the speakers (post-EQ10). One band is
+ * analyzed at a time, rotating every window, so the per-block cost is
+ * two Goertzel detectors (~0.15% CPU) regardless of band count.
+ * Windows without enough program energy at the band frequency are
+ * discarded. Does nothing while monitoring is disabled or a calibration
+ * is running.
+ *
+ * @param micInput Microphone input buffer (read-only, float32)
+ * @param speakerOutput Speaker output buffer as played (read-only, float32)
+ * @param numSamples Number of samples in buffers (typically 32)
+ */
+void QuickTune_MonitorProcessBlock(const float* micInput, const float* speakerOutput,
+                                   int numSamples);
+
+/**
+ * @brief Get background monitoring status
+ *
+ * @param status Output status structure
+ *
+ * @return true if filled in, false on invalid parameters
+ */
+bool QuickTune_GetMonitorStatus(QuickTuneMonitorStatus* status);
+
 /* ============================================================================
  * DIAGNOSTICS
  * ============================================================================ */
@@ -170,21 +573,219 @@ void QuickTune_ApplyGains(const float* gains);
  * - 1 = invalid state transition
  * - 2 = buffer overflow
  * - 3 = invalid parameters
+ * - 4 = preset validation failed (bad magic/version/CRC)
+ * - 5 = low-confidence measurement (SNR or convergence target missed,
+ *       see QuickTune_GetMeasurementDiag())
  *
  * @return Error code (0 = no error)
  */
 int QuickTune_GetLastError(void);
 
 /**
- * @brief Get CPU usage estimate (%)
+ * @brief Per-band measurement diagnostics (adaptive sequential mode)
+ *
+ * Filled in by the adaptive measurement controller during sequential
+ * calibration (QUICKTUNE_ADAPTIVE_ANALYSIS). Reflects the most recent
+ * measurement pass for each band.
+ */
+typedef struct
+{
+    /** Ambient level at fc with the tone muted (dB) */
+    float noise_floor_db[QUICKTUNE_NUM_BANDS];
+
+    /** Measured tone-to-noise ratio (dB) */
+    float snr_db[QUICKTUNE_NUM_BANDS];
+
+    /** Analysis window actually used (samples) */
+    uint32_t analysis_samples[QUICKTUNE_NUM_BANDS];
+
+    /** Bit per band: set when the SNR/convergence target was missed */
+    uint16_t low_confidence_mask;
+} QuickTuneMeasureDiag;
+
+/**
+ * @brief Get per-band measurement diagnostics
+ *
+ * Valid after at least one band has been measured in sequential mode.
+ * A set bit in low_confidence_mask means that band hit the maximum
+ * analysis window without stabilizing above the SNR target - the
+ * stored correction for it should be treated with suspicion (the UI
+ * can prompt the user to quiet the room and re-run).
+ *
+ * @param diag Output diagnostics structure
+ *
+ * @return true if diagnostics are available, false if none recorded or
+ *         the adaptive controller is compiled out
+ */
+bool QuickTune_GetMeasurementDiag(QuickTuneMeasureDiag* diag);
+
+/**
+ * @brief Per-band harmonic distortion levels (rub & buzz screening)
+ *
+ * Captured during sequential calibration by extra Goertzel detectors at
+ * 2x and 3x each band's stimulus frequency, running concurrently with
+ * the fundamental (QUICKTUNE_HARMONIC_CAPTURE).
+ */
+typedef struct
+{
+    /** 2nd harmonic level at 2*fc (dB, same scale as the band levels) */
+    float h2_db[QUICKTUNE_NUM_BANDS];
+
+    /** 3rd harmonic level at 3*fc (dB) */
+    float h3_db[QUICKTUNE_NUM_BANDS];
+
+    /** THD estimate: sqrt(H2^2 + H3^2) / fundamental, in percent */
+    float thd_percent[QUICKTUNE_NUM_BANDS];
+
+    /** Bit per band: set once that band's harmonics have been captured */
+    uint16_t valid_mask;
+} QuickTuneHarmonicLevels;
+
+/**
+ * @brief Get per-band harmonic levels and THD estimates
+ *
+ * Valid after at least one band has completed in sequential mode. The
+ * THD ratio is taken within a single analysis chunk, so it is
+ * independent of room gain and stimulus level - an abnormally high band
+ * (typically a few percent against fractions of a percent elsewhere)
+ * indicates rub & buzz or port noise at that frequency. Parallel and
+ * sweep modes do not capture harmonics: with all ten tones playing at
+ * once, a band's 2f/3f bins collide with other bands' fundamentals.
+ *
+ * @param levels Output harmonic levels structure
+ *
+ * @return true if any band has been captured, false if none recorded or
+ *         harmonic capture is compiled out
+ */
+bool QuickTune_GetHarmonicLevels(QuickTuneHarmonicLevels* levels);
+
+/** Sync byte opening every diagnostic spectrum record */
+#define QUICKTUNE_DIAG_SYNC         0xA5
+
+/** Record band field when no single band is being stimulated
+ *  (parallel/sweep mode, noise estimate, batch slot padding) */
+#define QUICKTUNE_DIAG_BAND_NONE    0xFF
+
+/**
+ * @brief One room response snapshot (QUICKTUNE_DIAG_CAPTURE)
+ *
+ * Emitted once per QUICKTUNE_DIAG_WINDOW_SAMPLES window while the state
+ * machine is MEASURING. Bin center frequencies are log-spaced:
+ * f(i) = MIN_HZ * (MAX_HZ / MIN_HZ)^(i / (QUICKTUNE_DIAG_BINS - 1)).
+ * The stream is a plain concatenation of these records, so a host can
+ * resynchronize on the sync byte and validate each record's CRC
+ * independently after a dropped UART chunk.
+ */
+typedef struct
+{
+    uint8_t sync;                   /**< QUICKTUNE_DIAG_SYNC */
+    uint8_t band;                   /**< Stimulated band, or BAND_NONE */
+    uint16_t seq;                   /**< Window sequence number; gaps mark
+                                         windows dropped under load */
+    uint8_t bins[QUICKTUNE_DIAG_BINS]; /**< Level in 0.5 dB steps:
+                                            dB = value / 2 - 120 */
+    uint32_t crc;                   /**< CRC32 (IEEE 802.3) of the
+                                         preceding record bytes */
+} QuickTuneDiagRecord;
+
+/** Record size in the stream (layout has no padding) */
+#define QUICKTUNE_DIAG_RECORD_SIZE  sizeof(QuickTuneDiagRecord)
+
+/**
+ * @brief Total diagnostic stream bytes produced since the last start
+ *
+ * Monotonic stream length; only the most recent
+ * QUICKTUNE_DIAG_RING_BYTES remain readable. Always a multiple of
+ * QUICKTUNE_DIAG_RECORD_SIZE.
+ *
+ * @return Stream length in bytes (0 if capture is compiled out)
+ */
+uint32_t QuickTune_GetDiagnosticsSize(void);
+
+/**
+ * @brief Read a chunk of the diagnostic stream
+ *
+ * Chunked readout for a slow control link: offsets are absolute stream
+ * positions, so the host polls QuickTune_GetDiagnosticsSize() and pulls
+ * whatever has appeared since its last offset, in chunks of any size.
+ * The stream is reset by each calibration start and retained after
+ * DONE, so a production host can also drain everything at the end.
+ * Call from the control/main-loop context (same as
+ * QuickTune_ControlTask(), which appends records).
+ *
+ * @param offset Absolute stream offset to read from
+ * @param buf Output buffer
+ * @param len Maximum bytes to copy
+ *
+ * @return Bytes copied (may be short at the stream end), 0 if offset is
+ *         at or past the stream end, -1 on invalid parameters or if
+ *         offset has already been overwritten in the ring
+ */
+int QuickTune_ReadDiagnostics(uint32_t offset, void* buf, int len);
+
+/**
+ * @brief Get CPU usage (%)
  *
- * Returns estimated CPU usage during calibration.
- * Useful for diagnostics and optimization.
+ * Returns measured CPU usage of the block processing in the current
+ * state (QuickTune path while calibrating, EQ10 cascade once done),
+ * derived from the DWT cycle counters. Returns 0.0 when profiling is
+ * compiled out (QUICKTUNE_ENABLE_PROFILING=0) or no blocks have been
+ * measured yet.
  *
  * @return CPU usage percentage (0.0 to 100.0)
  */
 float QuickTune_GetCpuUsage(void);
 
+/* ============================================================================
+ * PERFORMANCE STATISTICS
+ * ============================================================================ */
+
+/**
+ * @brief Min/avg/max cycle statistics for one instrumented section
+ */
+typedef struct
+{
+    uint32_t min_cycles;    /**< Best observed block */
+    uint32_t avg_cycles;    /**< Running average */
+    uint32_t max_cycles;    /**< Worst-case watermark */
+    uint32_t block_count;   /**< Number of measured blocks */
+} QuickTunePerfBucket;
+
+/**
+ * @brief Hot-path performance statistics
+ */
+typedef struct
+{
+    /** QuickTune_ProcessBlock cost, bucketed by state machine state
+     *  (indexed by QuickTuneState) */
+    QuickTunePerfBucket process_by_state[QUICKTUNE_NUM_STATES];
+
+    /** EQ10_ProcessBlock cost (post-calibration cascade) */
+    QuickTunePerfBucket eq10_block;
+
+    /** Worst-case execution time watermark across all sections (cycles) */
+    uint32_t wcet_cycles;
+} QuickTunePerfStats;
+
+/**
+ * @brief Get hot-path performance statistics
+ *
+ * Fills in DWT-measured cycle statistics for QuickTune_ProcessBlock
+ * (per state machine state) and EQ10_ProcessBlock, plus the overall
+ * worst-case watermark. Measurement overhead is ~15 cycles per block.
+ *
+ * @param stats Output statistics structure
+ *
+ * @return true if statistics are available, false if profiling is
+ *         compiled out (QUICKTUNE_ENABLE_PROFILING=0)
+ */
+bool QuickTune_GetPerfStats(QuickTunePerfStats* stats);
+
+/**
+ * @brief Reset all performance counters
+ */
+void QuickTune_ResetPerfStats(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,595 @@
+/**
+ * @file quicktune_bench.cpp
+ * @brief Host-side throughput benchmark with regression gate (make bench)
+ *
+ * Measures the hot paths on the development machine using the portable
+ * CMSIS-DSP subset in host/arm_math.h:
+ * - EQ10_ProcessBlock / EQ10_ProcessBlockMulti throughput (1/2/3 channels)
+ * - EQ10 Q31 path throughput
+ * - Full calibration state machine, loopback, faster-than-realtime
+ *   (parallel / sequential / sweep modes)
+ *
+ * Results are written to bench_results.json and compared against a
+ * checked-in baseline: any metric regressing by more than the tolerance
+ * fails the run (exit 1). Host numbers are machine-dependent - they
+ * gate relative regressions on one machine, not absolute target cycle
+ * budgets (those come from the DWT counters, see quicktune_profile.h).
+ * Regenerate the baseline after intentional changes or on a new machine
+ * with make bench-baseline.
+ *
+ * Usage: quicktune_bench [--update] <baseline.json>
+ *
+ * @author DSP Team (Implementation Agent)
+ * @date 2026-02-09
+ *
+ * CONFIDENTIAL - Binary-only delivery
+ */
+
+#include "quicktune.h"
+#include "eq10.h"
+#include "quicktune_config.h"
+#include "pipeline.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* ============================================================================
+ * CONFIGURATION
+ * ============================================================================ */
+
+/** Allowed fractional regression versus baseline (0.30 = 30% slower fails) */
+#define QT_BENCH_TOLERANCE          0.30
+
+/** Minimum timed duration per throughput measurement (seconds) */
+#define QT_BENCH_MIN_SECONDS        0.25
+
+/** Repeats per throughput measurement (best-of, to reject scheduler noise) */
+#define QT_BENCH_REPEATS            3
+
+/** Results file written next to the benchmark binary */
+#define QT_BENCH_RESULTS_FILE       "bench_results.json"
+
+/* ============================================================================
+ * METRICS
+ * ============================================================================ */
+
+#define QT_BENCH_MAX_METRICS        16
+
+static const char* s_metric_names[QT_BENCH_MAX_METRICS];
+static double s_metric_values[QT_BENCH_MAX_METRICS];
+static int s_metric_count = 0;
+
+static void Bench_Record(const char* name, double value)
+{
+    s_metric_names[s_metric_count] = name;
+    s_metric_values[s_metric_count] = value;
+    s_metric_count++;
+}
+
+static double Bench_Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* ============================================================================
+ * EQ10 THROUGHPUT
+ * ============================================================================ */
+
+/** Test signal: deterministic broadband-ish content so the cascade does real work */
+static void Bench_FillInput(float* buf, int n, uint32_t* seed)
+{
+    for (int i = 0; i < n; i++)
+    {
+        *seed = *seed * 1664525u + 1013904223u;
+        buf[i] = 0.25f * ((float)(*seed >> 9) / 4194304.0f - 1.0f);
+    }
+}
+
+/**
+ * @brief Measure EQ10 multi-channel throughput (blocks per second)
+ *
+ * @param numChannels Number of channels to process per block
+ * @return Best-of-N blocks per second
+ */
+static double Bench_Eq10BlocksPerSec(int numChannels)
+{
+    static float bufs[EQ10_MAX_CHANNELS][QUICKTUNE_BLOCK_SIZE];
+    float* channels[EQ10_MAX_CHANNELS];
+    uint32_t seed = 1;
+
+    for (int ch = 0; ch < numChannels; ch++)
+    {
+        channels[ch] = bufs[ch];
+        Bench_FillInput(bufs[ch], QUICKTUNE_BLOCK_SIZE, &seed);
+    }
+
+    double best = 0.0;
+    for (int rep = 0; rep < QT_BENCH_REPEATS; rep++)
+    {
+        long blocks = 0;
+        const double t0 = Bench_Now();
+        double t1;
+        do
+        {
+            for (int i = 0; i < 4096; i++)
+            {
+                if (numChannels == 1)
+                {
+                    EQ10_ProcessBlock(bufs[0], bufs[0], QUICKTUNE_BLOCK_SIZE);
+                }
+                else
+                {
+                    EQ10_ProcessBlockMulti(channels, numChannels, QUICKTUNE_BLOCK_SIZE);
+                }
+            }
+            blocks += 4096;
+            t1 = Bench_Now();
+        } while (t1 - t0 < QT_BENCH_MIN_SECONDS);
+
+        const double rate = (double)blocks / (t1 - t0);
+        if (rate > best)
+        {
+            best = rate;
+        }
+    }
+
+    return best;
+}
+
+#if EQ10_ENABLE_LIMITER
+/* ============================================================================
+ * LIMITER: FUSED STAGE VS LEGACY TWO-PASS ARRANGEMENT
+ * ============================================================================ */
+
+/**
+ * Standalone limiter pass replicating the arrangement the fused stage
+ * replaces: same per-sample math as EQ10_LimiterProcessBlock, but run
+ * as a separate traversal after EQ10_ProcessBlock() with its own
+ * input/output buffers, the way the previous firmware chained the
+ * modules.
+ */
+static float s_twopass_delay[EQ10_LIMITER_LOOKAHEAD_SAMPLES];
+static uint32_t s_twopass_idx = 0;
+static float s_twopass_env = 0.0f;
+static float s_twopass_gain = 1.0f;
+
+static void Bench_TwoPassLimiter(const float* in, float* out, int n)
+{
+    const float release = expf(-1000.0f / (EQ10_LIMITER_RELEASE_MS *
+                                           QUICKTUNE_SAMPLE_RATE));
+    const float attack = 1.0f - expf(-2.2f / (float)EQ10_LIMITER_LOOKAHEAD_SAMPLES);
+
+    for (int i = 0; i < n; i++)
+    {
+        const float x = in[i];
+        const float a = fabsf(x);
+        s_twopass_env *= release;
+        if (a > s_twopass_env)
+        {
+            s_twopass_env = a;
+        }
+        const float target = (s_twopass_env > EQ10_LIMITER_THRESHOLD)
+                                 ? EQ10_LIMITER_THRESHOLD / s_twopass_env
+                                 : 1.0f;
+        s_twopass_gain += (target - s_twopass_gain) *
+                          ((target < s_twopass_gain) ? attack : 1.0f - release);
+
+        const uint32_t slot = s_twopass_idx & (EQ10_LIMITER_LOOKAHEAD_SAMPLES - 1);
+        float y = s_twopass_delay[slot] * s_twopass_gain;
+        s_twopass_delay[slot] = x;
+        s_twopass_idx++;
+
+        if (y > 1.0f)  { y = 1.0f; }
+        if (y < -1.0f) { y = -1.0f; }
+        out[i] = y;
+    }
+}
+
+/**
+ * @brief Throughput ratio of the fused limiter vs the two-pass chain
+ *
+ * Both arrangements process the same blocks; the ratio isolates the
+ * cost of fusing the limiter into the cascade traversal versus running
+ * it as a second pass. > 1.0 means the fused stage is cheaper.
+ */
+static double Bench_LimiterFusedVsTwoPass(void)
+{
+    static float src[QUICKTUNE_BLOCK_SIZE];
+    static float buf[QUICKTUNE_BLOCK_SIZE];
+    static float out2[QUICKTUNE_BLOCK_SIZE];
+    uint32_t seed = 7;
+
+    Bench_FillInput(src, QUICKTUNE_BLOCK_SIZE, &seed);
+
+    double rates[2];
+    for (int arrangement = 0; arrangement < 2; arrangement++)
+    {
+        const bool fused = (arrangement == 0);
+        EQ10_SetLimiterEnabled(fused);
+
+        double best = 0.0;
+        for (int rep = 0; rep < QT_BENCH_REPEATS; rep++)
+        {
+            long blocks = 0;
+            const double t0 = Bench_Now();
+            double t1;
+            do
+            {
+                for (int i = 0; i < 4096; i++)
+                {
+                    memcpy(buf, src, sizeof(buf));
+                    if (fused)
+                    {
+                        EQ10_ProcessBlock(buf, buf, QUICKTUNE_BLOCK_SIZE);
+                    }
+                    else
+                    {
+                        EQ10_ProcessBlock(buf, buf, QUICKTUNE_BLOCK_SIZE);
+                        Bench_TwoPassLimiter(buf, out2, QUICKTUNE_BLOCK_SIZE);
+                    }
+                }
+                blocks += 4096;
+                t1 = Bench_Now();
+            } while (t1 - t0 < QT_BENCH_MIN_SECONDS);
+
+            const double rate = (double)blocks / (t1 - t0);
+            if (rate > best)
+            {
+                best = rate;
+            }
+        }
+        rates[arrangement] = best;
+    }
+
+    EQ10_SetLimiterEnabled(true);
+    return 100.0 * rates[0] / rates[1];
+}
+#endif /* EQ10_ENABLE_LIMITER */
+
+/* ============================================================================
+ * PIPELINE CHAIN OVERHEAD
+ * ============================================================================ */
+
+/* noinline: real chain stages live in separately compiled modules, so
+ * the hand-rolled arrangement must not beat the pipeline by inlining
+ * stage math the target build could never inline */
+
+/** Cubic soft-clip, in-place capable */
+__attribute__((noinline))
+static void Bench_SoftClipStage(float* input, float* output, int numSamples)
+{
+    for (int i = 0; i < numSamples; i++)
+    {
+        const float x = input[i];
+        output[i] = x - 0.333333f * x * x * x;
+    }
+}
+
+/** Output gain trim, in-place capable */
+__attribute__((noinline))
+static void Bench_GainStage(float* input, float* output, int numSamples)
+{
+    for (int i = 0; i < numSamples; i++)
+    {
+        output[i] = 0.8f * input[i];
+    }
+}
+
+/**
+ * @brief Pipeline runner vs the hand-rolled chain it replaces
+ *
+ * Chain: EQ10 -> soft-clip -> gain. The hand-rolled arrangement calls
+ * each stage with its own intermediate buffer (the shipping pattern);
+ * the pipeline arrangement registers the same stages and runs the
+ * fused loop on arena slots. Identical stage math on both sides, so
+ * the ratio isolates chain overhead.
+ *
+ * @return Pipeline throughput as a percentage of hand-rolled
+ */
+static double Bench_PipelineVsHandRolled(void)
+{
+    static float src[QUICKTUNE_BLOCK_SIZE];
+    static float t1[QUICKTUNE_BLOCK_SIZE];
+    static float t2[QUICKTUNE_BLOCK_SIZE];
+    static float out[QUICKTUNE_BLOCK_SIZE];
+    uint32_t seed = 11;
+
+    Bench_FillInput(src, QUICKTUNE_BLOCK_SIZE, &seed);
+
+    Pipeline_Init();
+    Pipeline_AddStage(EQ10_ProcessBlock, PIPELINE_STAGE_IN_PLACE);
+    Pipeline_AddStage(Bench_SoftClipStage, PIPELINE_STAGE_IN_PLACE);
+    Pipeline_AddStage(Bench_GainStage, PIPELINE_STAGE_IN_PLACE);
+
+    double rates[2];
+    for (int arrangement = 0; arrangement < 2; arrangement++)
+    {
+        const bool pipelined = (arrangement == 0);
+
+        double best = 0.0;
+        for (int rep = 0; rep < QT_BENCH_REPEATS; rep++)
+        {
+            long blocks = 0;
+            const double t0 = Bench_Now();
+            double tnow;
+            do
+            {
+                for (int i = 0; i < 4096; i++)
+                {
+                    if (pipelined)
+                    {
+                        Pipeline_ProcessBlock(src, out, QUICKTUNE_BLOCK_SIZE);
+                    }
+                    else
+                    {
+                        EQ10_ProcessBlock(src, t1, QUICKTUNE_BLOCK_SIZE);
+                        Bench_SoftClipStage(t1, t2, QUICKTUNE_BLOCK_SIZE);
+                        Bench_GainStage(t2, out, QUICKTUNE_BLOCK_SIZE);
+                    }
+                }
+                blocks += 4096;
+                tnow = Bench_Now();
+            } while (tnow - t0 < QT_BENCH_MIN_SECONDS);
+
+            const double rate = (double)blocks / (tnow - t0);
+            if (rate > best)
+            {
+                best = rate;
+            }
+        }
+        rates[arrangement] = best;
+    }
+
+    Pipeline_Init();
+    return 100.0 * rates[0] / rates[1];
+}
+
+/* ============================================================================
+ * CALIBRATION (FASTER-THAN-REALTIME LOOPBACK)
+ * ============================================================================ */
+
+/**
+ * @brief Run a full calibration in loopback and measure the speedup
+ *
+ * The mic input is the previous speaker block (ideal flat room with one
+ * block of delay). Returns simulated-audio-seconds per wall-second.
+ *
+ * @param mode Measurement mode to benchmark
+ * @return Faster-than-realtime factor (e.g. 300 = 300x realtime)
+ */
+static double Bench_CalibrationXRealtime(QuickTuneMode mode)
+{
+    static float spk[QUICKTUNE_BLOCK_SIZE];
+    static float mic[QUICKTUNE_BLOCK_SIZE];
+
+    QuickTune_Init();
+    QuickTune_Start(mode);
+    memset(spk, 0, sizeof(spk));
+
+    long blocks = 0;
+    const long max_blocks = 60L * QUICKTUNE_SAMPLE_RATE / QUICKTUNE_BLOCK_SIZE;
+
+    const double t0 = Bench_Now();
+    while (QuickTune_GetState() != QUICKTUNE_STATE_DONE && blocks < max_blocks)
+    {
+        memcpy(mic, spk, sizeof(spk));
+        QuickTune_ProcessBlock(mic, spk, QUICKTUNE_BLOCK_SIZE);
+        QuickTune_ControlTask();
+        blocks++;
+    }
+    const double wall = Bench_Now() - t0;
+
+    if (QuickTune_GetState() != QUICKTUNE_STATE_DONE)
+    {
+        fprintf(stderr, "bench: calibration mode %d did not complete\n", (int)mode);
+        exit(1);
+    }
+
+    QuickTune_Stop();
+
+    const double audio_secs = (double)blocks * QUICKTUNE_BLOCK_SIZE / QUICKTUNE_SAMPLE_RATE;
+    return audio_secs / wall;
+}
+
+/* ============================================================================
+ * BASELINE FILE (FLAT JSON OBJECT)
+ * ============================================================================ */
+
+/**
+ * @brief Look up one metric in a baseline JSON buffer
+ *
+ * The baseline is a flat object written by this tool, so a plain scan
+ * for the quoted key followed by the number is sufficient - no JSON
+ * dependency needed.
+ *
+ * @return true if found, value stored in *out
+ */
+static bool Baseline_Lookup(const char* json, const char* name, double* out)
+{
+    char key[96];
+    snprintf(key, sizeof(key), "\"%s\"", name);
+
+    const char* p = strstr(json, key);
+    if (p == NULL)
+    {
+        return false;
+    }
+
+    p = strchr(p + strlen(key), ':');
+    if (p == NULL)
+    {
+        return false;
+    }
+
+    *out = strtod(p + 1, NULL);
+    return true;
+}
+
+static char* Baseline_Read(const char* path)
+{
+    FILE* f = fopen(path, "rb");
+    if (f == NULL)
+    {
+        return NULL;
+    }
+
+    fseek(f, 0, SEEK_END);
+    const long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    char* buf = (char*)malloc((size_t)size + 1);
+    if (fread(buf, 1, (size_t)size, f) != (size_t)size)
+    {
+        fclose(f);
+        free(buf);
+        return NULL;
+    }
+    buf[size] = '\0';
+    fclose(f);
+    return buf;
+}
+
+static void Results_Write(const char* path)
+{
+    FILE* f = fopen(path, "w");
+    if (f == NULL)
+    {
+        fprintf(stderr, "bench: cannot write %s\n", path);
+        exit(1);
+    }
+
+    fprintf(f, "{\n");
+    for (int i = 0; i < s_metric_count; i++)
+    {
+        fprintf(f, "  \"%s\": %.1f%s\n", s_metric_names[i], s_metric_values[i],
+                (i < s_metric_count - 1) ? "," : "");
+    }
+    fprintf(f, "}\n");
+    fclose(f);
+}
+
+/* ============================================================================
+ * MAIN
+ * ============================================================================ */
+
+int main(int argc, char** argv)
+{
+    bool update_baseline = false;
+    const char* baseline_path = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--update") == 0)
+        {
+            update_baseline = true;
+        }
+        else
+        {
+            baseline_path = argv[i];
+        }
+    }
+
+    if (baseline_path == NULL)
+    {
+        fprintf(stderr, "usage: quicktune_bench [--update] <baseline.json>\n");
+        return 1;
+    }
+
+    /* ---- EQ10 throughput ---- */
+    EQ10_Init();
+    static const float bench_gains[QUICKTUNE_NUM_BANDS] = {
+        6.0f, -4.0f, 3.0f, -2.0f, 5.0f, -6.0f, 2.0f, -3.0f, 4.0f, -5.0f
+    };
+    EQ10_SetAllGains(bench_gains, QUICKTUNE_EQ_Q);
+
+    Bench_Record("eq10_f32_ch1_blocks_per_sec", Bench_Eq10BlocksPerSec(1));
+    Bench_Record("eq10_f32_ch2_blocks_per_sec", Bench_Eq10BlocksPerSec(2));
+    Bench_Record("eq10_f32_ch3_blocks_per_sec", Bench_Eq10BlocksPerSec(3));
+
+    EQ10_SetProcessingMode(EQ10_MODE_Q31);
+    Bench_Record("eq10_q31_ch1_blocks_per_sec", Bench_Eq10BlocksPerSec(1));
+    EQ10_SetProcessingMode(EQ10_MODE_F32);
+
+    #if EQ10_ENABLE_LIMITER
+    Bench_Record("eq10_limiter_fused_x_twopass_pct", Bench_LimiterFusedVsTwoPass());
+    #endif
+
+    /* ---- Pipeline chain overhead ---- */
+    Bench_Record("pipeline_chain_x_handrolled_pct", Bench_PipelineVsHandRolled());
+
+    /* ---- Calibration state machine, faster than realtime ---- */
+    Bench_Record("calib_parallel_x_realtime",
+                 Bench_CalibrationXRealtime(QUICKTUNE_MODE_PARALLEL));
+    Bench_Record("calib_sequential_x_realtime",
+                 Bench_CalibrationXRealtime(QUICKTUNE_MODE_SEQUENTIAL));
+    Bench_Record("calib_sweep_x_realtime",
+                 Bench_CalibrationXRealtime(QUICKTUNE_MODE_SWEEP));
+
+    /* ---- Report ---- */
+    for (int i = 0; i < s_metric_count; i++)
+    {
+        printf("%-36s %14.1f\n", s_metric_names[i], s_metric_values[i]);
+    }
+
+    Results_Write(QT_BENCH_RESULTS_FILE);
+
+    if (update_baseline)
+    {
+        Results_Write(baseline_path);
+        printf("baseline updated: %s\n", baseline_path);
+        return 0;
+    }
+
+    /* ---- Regression gate ---- */
+    char* baseline = Baseline_Read(baseline_path);
+    if (baseline == NULL)
+    {
+        printf("no baseline at %s - run 'make bench-baseline' to create one\n",
+               baseline_path);
+        return 0;
+    }
+
+    double tolerance = QT_BENCH_TOLERANCE;
+    const char* tol_env = getenv("BENCH_TOLERANCE");
+    if (tol_env != NULL)
+    {
+        tolerance = strtod(tol_env, NULL);
+    }
+
+    int failures = 0;
+    for (int i = 0; i < s_metric_count; i++)
+    {
+        double ref;
+        if (!Baseline_Lookup(baseline, s_metric_names[i], &ref))
+        {
+            printf("NOTE %s missing from baseline (new metric?)\n", s_metric_names[i]);
+            continue;
+        }
+
+        const double floor_val = ref * (1.0 - tolerance);
+        if (s_metric_values[i] < floor_val)
+        {
+            printf("FAIL %s: %.1f < %.1f (baseline %.1f, tolerance %.0f%%)\n",
+                   s_metric_names[i], s_metric_values[i], floor_val, ref,
+                   tolerance * 100.0);
+            failures++;
+        }
+    }
+
+    free(baseline);
+
+    if (failures > 0)
+    {
+        printf("bench: %d metric(s) regressed\n", failures);
+        return 1;
+    }
+
+    printf("bench: all %d metrics within %.0f%% of baseline\n",
+           s_metric_count, tolerance * 100.0);
+    return 0;
+}
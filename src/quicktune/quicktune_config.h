@@ -49,12 +49,224 @@
 #define QUICKTUNE_TONE_ANALYSIS_SAMPLES 4800   /* 48000 * 100 / 1000 */
 #define QUICKTUNE_TONE_TOTAL_SAMPLES    14400  /* 48000 * 300 / 1000 */
 
+/* ============================================================================
+ * ADAPTIVE ANALYSIS (SEQUENTIAL MODE)
+ * ============================================================================ */
+
+/**
+ * Adaptive measurement controller for sequential mode: each band starts
+ * with a short noise floor estimate (tone muted, Goertzel at fc), then
+ * the tone analysis runs in whole-cycle chunks with early termination
+ * once the chunk-to-chunk level stabilizes and clears the SNR target.
+ * There is no fixed settling period - room ringing shows up as chunk
+ * drift and simply defers convergence. Quiet rooms converge in 2-3
+ * chunks (2-3x faster than the fixed 300 ms/tone schedule); noisy rooms
+ * extend the window up to the maximum and are flagged low-confidence
+ * (error code 5, QuickTune_GetMeasurementDiag()) instead of silently
+ * producing a bad calibration.
+ */
+#ifndef QUICKTUNE_ADAPTIVE_ANALYSIS
+#define QUICKTUNE_ADAPTIVE_ANALYSIS         1
+#endif
+
+/** Minimum analysis chunk length (samples) - rounded up to whole cycles of fc */
+#define QUICKTUNE_ANALYSIS_CHUNK_SAMPLES    1200   /* 25 ms */
+
+/** Noise floor estimate duration (chunks, tone muted) */
+#define QUICKTUNE_NOISE_EST_CHUNKS          2
+
+/** Minimum chunks before early termination is considered */
+#define QUICKTUNE_ANALYSIS_MIN_CHUNKS       2
+
+/** Maximum chunks before the measurement is flagged low-confidence */
+#define QUICKTUNE_ANALYSIS_MAX_CHUNKS       12
+
+/** Target tone-to-noise ratio at the band frequency (dB) */
+#define QUICKTUNE_TARGET_SNR_DB             20.0f
+
+/** Chunk-to-chunk stabilization tolerance (dB) */
+#define QUICKTUNE_ANALYSIS_SETTLE_TOL_DB    0.3f
+
+/* ============================================================================
+ * DECIMATED LOW-RATE ANALYSIS (SUB-100 HZ BANDS)
+ * ============================================================================ */
+
+/**
+ * Measure the lowest bands at a decimated sample rate: an anti-alias
+ * FIR decimates the mic by QUICKTUNE_DECIM_FACTOR (48 kHz -> 3 kHz) and
+ * the Goertzel detectors run on the low-rate stream. The decimating FIR
+ * computes only the retained outputs (~4 MAC/input sample at 64 taps),
+ * so a sub-100 Hz band costs ~5 cycles/sample instead of the ~16 of
+ * four full-rate detectors. The chunk windows are recomputed as whole
+ * cycles at the low rate, so bin placement stays exact. Sequential
+ * adaptive mode only; requires QUICKTUNE_ADAPTIVE_ANALYSIS.
+ *
+ * The coarser low-rate window quantization costs the 63 Hz band a small
+ * extra leakage floor in the harmonic bins (~0.3% THD equivalent) -
+ * still an order of magnitude below rub & buzz defect levels.
+ */
+#ifndef QUICKTUNE_DECIMATED_ANALYSIS
+#define QUICKTUNE_DECIMATED_ANALYSIS        1
+#endif
+
+/** Decimation factor (48 kHz -> 3 kHz; block size must stay divisible) */
+#define QUICKTUNE_DECIM_FACTOR              16
+
+/** Bands with fc strictly below this use the decimated path (25/40/63 Hz) */
+#define QUICKTUNE_DECIM_CROSSOVER_HZ        100.0f
+
+/**
+ * Anti-alias FIR: Hamming windowed sinc, 400 Hz cutoff. Passband is
+ * flat through 3*63 = 189 Hz (highest harmonic bin analyzed) and the
+ * wide transition to the first alias zone (3000 - 189 = 2811 Hz) gives
+ * > 50 dB stopband at 64 taps.
+ */
+#define QUICKTUNE_DECIM_NUM_TAPS            64
+#define QUICKTUNE_DECIM_FIR_CUTOFF_HZ      400.0
+
+/* ============================================================================
+ * PARALLEL MULTI-TONE MODE
+ * ============================================================================ */
+
+/**
+ * Parallel mode plays all 10 band tones simultaneously (one multi-tone
+ * stimulus per iteration instead of 10 sequential tones), cutting total
+ * calibration time from ~9 s to ~1.2 s over 3 iterations.
+ *
+ * The analysis window is doubled versus sequential mode (200 ms, 5 Hz bin
+ * spacing) so neighbouring tones fall far enough apart in Goertzel bins
+ * that inter-tone leakage stays below the measurement noise floor.
+ */
+
+/** Settling time for the multi-tone stimulus (ms) */
+#define QUICKTUNE_PARALLEL_SETTLING_MS      200
+
+/** Analysis time for the multi-tone stimulus (ms) */
+#define QUICKTUNE_PARALLEL_ANALYSIS_MS      200
+
+/* Convert to samples */
+#define QUICKTUNE_PARALLEL_SETTLING_SAMPLES 9600   /* 48000 * 200 / 1000 */
+#define QUICKTUNE_PARALLEL_ANALYSIS_SAMPLES 9600   /* 48000 * 200 / 1000 */
+#define QUICKTUNE_PARALLEL_TOTAL_SAMPLES    19200  /* 48000 * 400 / 1000 */
+
+/**
+ * Per-tone amplitude for the composite stimulus.
+ *
+ * With Newman phases (phi_k = pi*(k-1)^2/K) the 10-tone composite has a
+ * crest factor near sqrt(2), so peak level ~= amplitude * sqrt(K).
+ * 0.15 per tone keeps the composite peak near the 0.5 level used by the
+ * sequential single tones.
+ */
+#define QUICKTUNE_PARALLEL_TONE_AMPLITUDE   0.15f
+
+/* ============================================================================
+ * SWEEP MODE
+ * ============================================================================ */
+
+/**
+ * Sweep mode plays one logarithmic sine sweep across all bands and
+ * extracts the 10 band magnitudes in a single pass: each band's
+ * Goertzel detector runs over the sweep segment whose instantaneous
+ * frequency falls inside that band's log-spaced window, referenced
+ * against an identical detector on the generated stimulus so window
+ * scalloping cancels. One iteration costs the sweep duration only -
+ * no per-band settling/restart dead time.
+ */
+
+/** Sweep start frequency (Hz) - below band 1 so its window edge is covered */
+#define QUICKTUNE_SWEEP_START_HZ        20.0f
+
+/** Sweep end frequency (Hz) - above band 10 so its window edge is covered */
+#define QUICKTUNE_SWEEP_END_HZ          2000.0f
+
+/** Sweep duration (ms) */
+#define QUICKTUNE_SWEEP_DURATION_MS     700
+
+/** Sweep duration (samples) */
+#define QUICKTUNE_SWEEP_TOTAL_SAMPLES   33600  /* 48000 * 700 / 1000 */
+
+/** Sweep amplitude (0.0 to 1.0) */
+#define QUICKTUNE_SWEEP_AMPLITUDE       0.5f
+
+/* ============================================================================
+ * BACKGROUND ROOM MONITORING
+ * ============================================================================ */
+
+/**
+ * Continuous monitoring runs the Goertzel machinery on program material
+ * during normal playback: one band at a time (time-multiplexed across
+ * blocks), with a detector pair on the mic and on the known speaker
+ * output so the per-band room transfer falls out as the level
+ * difference. Windows with too little program energy at the band
+ * frequency are discarded; accepted measurements feed an exponential
+ * average, and sustained deviation from the post-calibration reference
+ * raises a drift flag.
+ *
+ * Cost: 2 detectors x ~4 cycles/sample for one band = ~256 cycles per
+ * 32-sample block = ~0.15% CPU - safely coexists with EQ10 + BassGuard.
+ */
+
+/** Minimum monitor window (samples) - rounded up to whole cycles of fc */
+#define QUICKTUNE_MONITOR_WINDOW_SAMPLES    4800   /* 100 ms */
+
+/** Minimum speaker level at fc for a window to count (dB) */
+#define QUICKTUNE_MONITOR_MIN_LEVEL_DB      (-50.0f)
+
+/** Exponential averaging weight for accepted measurements */
+#define QUICKTUNE_MONITOR_ALPHA             0.1f
+
+/** Accepted measurements before the reference transfer is latched */
+#define QUICKTUNE_MONITOR_REF_UPDATES       8
+
+/** Deviation from the reference that raises the drift flag (dB) */
+#define QUICKTUNE_MONITOR_DRIFT_DB          3.0f
+
+/* ============================================================================
+ * DIAGNOSTIC SPECTRUM CAPTURE
+ * ============================================================================ */
+
+/**
+ * Room response snapshot engine: during MEASURING a bank of
+ * QUICKTUNE_DIAG_BINS log-spaced Goertzel detectors runs on the mic and
+ * emits one compact record per analysis window into a bounded SRAM ring
+ * (QuickTune_ReadDiagnostics() streams it out in arbitrary chunks over
+ * the control link). The ISR only accumulates the bank (~5% CPU while
+ * measuring); magnitude finalize, quantization and CRC run in
+ * QuickTune_ControlTask(). An 8 s sequential calibration produces ~80
+ * records = ~5.8 KB, which fits the ring whole.
+ */
+#ifndef QUICKTUNE_DIAG_CAPTURE
+#define QUICKTUNE_DIAG_CAPTURE              1
+#endif
+
+/** Spectrum bins per record, log-spaced MIN..MAX Hz */
+#define QUICKTUNE_DIAG_BINS                 64
+#define QUICKTUNE_DIAG_MIN_HZ               20.0
+#define QUICKTUNE_DIAG_MAX_HZ               2000.0
+
+/** Capture window (samples): one record per 100 ms */
+#define QUICKTUNE_DIAG_WINDOW_SAMPLES       4800
+
+/** Stream ring capacity (bytes); oldest records are overwritten */
+#define QUICKTUNE_DIAG_RING_BYTES           8192
+
 /* ============================================================================
  * EQ10 BAND FREQUENCIES (Hz)
  * ============================================================================ */
 
+/**
+ * constexpr in C++ so the compile-time filter design in
+ * quicktune_tables.h can consume the frequencies; plain const for any
+ * C translation units.
+ */
+#ifdef __cplusplus
+#define QUICKTUNE_TABLE_CONST           constexpr
+#else
+#define QUICKTUNE_TABLE_CONST           const
+#endif
+
 /** EQ10 band center frequencies */
-static const float QUICKTUNE_BAND_FREQUENCIES[QUICKTUNE_NUM_BANDS] = {
+static QUICKTUNE_TABLE_CONST float QUICKTUNE_BAND_FREQUENCIES[QUICKTUNE_NUM_BANDS] = {
     25.0f,      // Band 1
     40.0f,      // Band 2
     63.0f,      // Band 3
@@ -89,6 +301,161 @@ static const float QUICKTUNE_MEMS_CALIBRATION[QUICKTUNE_NUM_BANDS] = {
     0.0f        // 1600 Hz
 };
 
+/* ============================================================================
+ * EQ10 BACKEND SELECTION
+ * ============================================================================ */
+
+/** Direct Form I cascade (arm_biquad_cascade_df1_f32, 4 state words/stage) */
+#define EQ10_BACKEND_DF1                1
+
+/** Transposed Direct Form II cascade (arm_biquad_cascade_df2T_f32, 2 state words/stage) */
+#define EQ10_BACKEND_DF2T               2
+
+/**
+ * Active EQ10 backend (override with -DEQ10_BACKEND=... at build time).
+ *
+ * DF2T halves the state memory and is measurably faster on the M33 with
+ * FPv5; it is also numerically better behaved for the 25 Hz band where
+ * fc/fs is tiny. Both backends consume the same normalized coefficient
+ * format [b0, b1, b2, a1, a2], so EQ10_DesignBiquad() output and saved
+ * presets are interchangeable. See eq10_benchmark.cpp for cycles/block
+ * comparison of the two.
+ */
+#ifndef EQ10_BACKEND
+#define EQ10_BACKEND                    EQ10_BACKEND_DF2T
+#endif
+
+/* ============================================================================
+ * COMPILE-TIME COEFFICIENT TABLES
+ * ============================================================================ */
+
+/**
+ * Optional precomputed coefficient grid: fixed-Q designs at the ten
+ * band frequencies over the quantized gain range (0.5 dB steps across
+ * +/-12 dB), generated at compile time by quicktune_tables.h. Costs
+ * ~10 KB of flash; enables zero-transcendental gain changes at runtime.
+ * The flat-response boot table is always generated (it is one row).
+ */
+#ifndef EQ10_ENABLE_COEFF_GRID
+#define EQ10_ENABLE_COEFF_GRID          0
+#endif
+
+/** Coefficient grid gain quantization (dB per step) */
+#define EQ10_COEFF_GRID_STEP_DB         0.5f
+
+/* ============================================================================
+ * RUNTIME COEFFICIENT CACHE
+ * ============================================================================ */
+
+/**
+ * Direct-mapped coefficient cache inside eq10.cpp, keyed on (band,
+ * quantized gain): the dB-domain setters serve repeated designs as a
+ * 20-byte copy instead of powf + sin/cos + divides. Unlike the
+ * flash-resident grid above it fills lazily at runtime, caches whatever
+ * Q is in use, and costs SRAM (10 bands x 97 steps x 28 B = ~27 KB).
+ * When enabled, gains set through EQ10_SetBandGain / EQ10_SetAllGains /
+ * EQ10_RampToGains are realized at EQ10_COEFF_CACHE_STEP_DB resolution
+ * (0.125 dB worst-case rounding, well under the measurement accuracy).
+ */
+#ifndef EQ10_ENABLE_COEFF_CACHE
+#define EQ10_ENABLE_COEFF_CACHE         1
+#endif
+
+/** Coefficient cache gain quantization (dB per step) */
+#define EQ10_COEFF_CACHE_STEP_DB        0.25f
+
+/**
+ * Pre-warm the whole cache at QUICKTUNE_EQ_Q during EQ10_Init() so no
+ * design ever runs at control time. Costs ~970 designs at boot (a few
+ * ms on target); off by default - lazy fills amortize the same work.
+ */
+#ifndef EQ10_COEFF_CACHE_PREWARM
+#define EQ10_COEFF_CACHE_PREWARM        0
+#endif
+
+/* ============================================================================
+ * MEMORY PLACEMENT (FAST CODE / DATA SECTIONS)
+ * ============================================================================ */
+
+/**
+ * Route the audio hot path into dedicated linker sections: the block
+ * processing inner loops (biquad cascade, Goertzel, tone generation) go
+ * to .quicktune_fast_code and the cascade state/coefficient arrays to
+ * .quicktune_fast_data, so the application's linker script can place
+ * them in zero-wait-state SRAM instead of wait-stated flash and
+ * DMA-contended general SRAM (the H562 has no TCM; on our board an
+ * SRAM2 placement is worth 20-30% on the cascade). Off by default so
+ * the module builds standalone and on the host; see
+ * quicktune_sections.ld for the matching linker fragment and the
+ * required startup copy.
+ */
+#ifndef QUICKTUNE_ENABLE_FAST_SECTIONS
+#define QUICKTUNE_ENABLE_FAST_SECTIONS  0
+#endif
+
+#if QUICKTUNE_ENABLE_FAST_SECTIONS
+#define QUICKTUNE_FAST_CODE     __attribute__((section(".quicktune_fast_code")))
+#define QUICKTUNE_FAST_DATA     __attribute__((section(".quicktune_fast_data")))
+#else
+#define QUICKTUNE_FAST_CODE
+#define QUICKTUNE_FAST_DATA
+#endif
+
+/* ============================================================================
+ * COEFFICIENT UPDATE SCHEDULER
+ * ============================================================================ */
+
+/**
+ * Bands redesigned per block by the EQ10 ramp engine (1 or 2). Each
+ * redesign is a few hundred cycles, so this bounds the worst-case
+ * coefficient-update cost of any block; 2 halves the apply latency at
+ * twice the per-block cost.
+ */
+#ifndef EQ10_RAMP_BANDS_PER_BLOCK
+#define EQ10_RAMP_BANDS_PER_BLOCK       1
+#endif
+
+/**
+ * Ramp length (blocks) used when calibration applies correction gains.
+ * The full apply takes this plus the final exact-target round-robin
+ * pass (EQ10_NUM_BANDS / EQ10_RAMP_BANDS_PER_BLOCK blocks): ~9 ms at
+ * the defaults, against measurement passes that run for seconds.
+ */
+#ifndef QUICKTUNE_APPLY_RAMP_BLOCKS
+#define QUICKTUNE_APPLY_RAMP_BLOCKS     3
+#endif
+
+/* ============================================================================
+ * OUTPUT LIMITER (SAFESOUND)
+ * ============================================================================ */
+
+/**
+ * Lookahead peak limiter fused into the EQ10 block traversal: with up
+ * to +12 dB of correction boost, program material can clip the DAC, and
+ * running the limiter as a separate pass costs a second set of block
+ * loads/stores every 667 us. The fused stage runs over the cascade
+ * output while it is still hot in cache (~14 cycles/sample, vs ~19 for
+ * the standalone pass it replaces) and hard-clamps to full scale as a
+ * final safety net.
+ */
+#ifndef EQ10_ENABLE_LIMITER
+#define EQ10_ENABLE_LIMITER             1
+#endif
+
+/** Limit ceiling (linear): 0.891 = -1 dBFS */
+#define EQ10_LIMITER_THRESHOLD          0.891f
+
+/**
+ * Lookahead (samples, power of two): one block = 667 us of added output
+ * latency, well inside the 10 ms round-trip budget. The attack
+ * smoothing reaches the target gain within this window, so peaks are
+ * caught before their delayed samples leave the stage.
+ */
+#define EQ10_LIMITER_LOOKAHEAD_SAMPLES  32
+
+/** Release time constant (ms) for gain recovery */
+#define EQ10_LIMITER_RELEASE_MS         80.0f
+
 /* ============================================================================
  * CORRECTION PARAMETERS
  * ============================================================================ */
@@ -105,12 +472,47 @@ static const float QUICKTUNE_MEMS_CALIBRATION[QUICKTUNE_NUM_BANDS] = {
 /** Target accuracy (dB) - validation threshold */
 #define QUICKTUNE_TARGET_ACCURACY_DB    1.0f
 
+/* ============================================================================
+ * GOERTZEL PRECISION
+ * ============================================================================ */
+
+/**
+ * Double-precision state for the sequential tone detector: over a
+ * 4800-sample window the f32 recurrence grows s1/s2 to ~N*A/2, and the
+ * final power s1^2 + s2^2 - coeff*s1*s2 cancels catastrophically -
+ * most of the significand is lost for a strong in-band signal. An f64
+ * accumulator keeps the cancellation exact to well below 0.01 dB.
+ *
+ * Cortex-M33 has no double FPU, so the f64 recurrence runs in
+ * softfloat (~50 cycles/op). That is acceptable for the single-bin
+ * sequential detector, which only runs during calibration; the
+ * parallel and diagnostic Goertzel banks (10-64 bins per sample) stay
+ * f32 - their finalize step still computes the power difference in f64
+ * through the shared helper, which removes most of the error at no
+ * per-sample cost.
+ */
+#ifndef QUICKTUNE_GOERTZEL_F64
+#define QUICKTUNE_GOERTZEL_F64          1
+#endif
+
 /* ============================================================================
  * ITERATIVE REFINEMENT
  * ============================================================================ */
 
-/** Maximum number of iterative refinement passes */
+/**
+ * Maximum number of iterative refinement passes. With the f64 detector
+ * the per-measurement error no longer stacks against the ±1 dB target,
+ * so two passes (measure + one residual check) reach the same final
+ * accuracy the f32 detector needed three for - a 33% calibration-time
+ * saving (see validation/quicktune/goertzel_precision_validation.py).
+ */
+#ifndef QUICKTUNE_MAX_ITERATIONS
+#if QUICKTUNE_GOERTZEL_F64
+#define QUICKTUNE_MAX_ITERATIONS        2
+#else
 #define QUICKTUNE_MAX_ITERATIONS        3
+#endif
+#endif
 
 /** Damping factor for iterative refinement (0.0 to 1.0) */
 #define QUICKTUNE_DAMPING_FACTOR        0.7f
@@ -118,6 +520,74 @@ static const float QUICKTUNE_MEMS_CALIBRATION[QUICKTUNE_NUM_BANDS] = {
 /** Enable/disable iterative refinement */
 #define QUICKTUNE_ENABLE_ITERATION      1
 
+/* ============================================================================
+ * HARMONIC CAPTURE (RUB & BUZZ SCREENING)
+ * ============================================================================ */
+
+/**
+ * Run additional Goertzel detectors at 2x and 3x the stimulus frequency
+ * during sequential band measurement and record per-band harmonic
+ * levels and THD (see QuickTune_GetHarmonicLevels()). Piggybacks on the
+ * calibration stimulus, so end-of-line rub & buzz screening needs no
+ * separate distortion pass. Requires the adaptive sequential controller
+ * (QUICKTUNE_ADAPTIVE_ANALYSIS). Cost: three extra detectors (~12
+ * cycles/sample) during sequential measurement only.
+ */
+#ifndef QUICKTUNE_HARMONIC_CAPTURE
+#define QUICKTUNE_HARMONIC_CAPTURE      1
+#endif
+
+/* ============================================================================
+ * MULTI-UNIT BATCH CALIBRATION (PRODUCTION LINE)
+ * ============================================================================ */
+
+/**
+ * Fixed time-slot length (samples) per band in batch mode
+ * (QuickTune_StartBatch()). Units in one acoustic cell calibrate
+ * concurrently by measuring the bands in rotated orders; since the
+ * adaptive controller terminates early in quiet rooms, each band's slot
+ * is padded with silence to this fixed length so every unit advances
+ * bands in lockstep. Must cover the adaptive worst case at the longest
+ * chunk window (25 Hz: 2 noise chunks + fade-in + 12 analysis chunks +
+ * fade-out = 2*1920 + 480 + 12*1920 + 480 = 27840 samples); a band that
+ * somehow overruns the slot simply advances late, degrading to partial
+ * overlap instead of failing. 28800 = 600 ms = 900 blocks.
+ */
+#ifndef QUICKTUNE_BATCH_SLOT_SAMPLES
+#define QUICKTUNE_BATCH_SLOT_SAMPLES    28800
+#endif
+
+/* ============================================================================
+ * TWO-TIER EXECUTION
+ * ============================================================================ */
+
+/**
+ * Length of the SPSC event queue between the audio ISR and
+ * QuickTune_ControlTask() (must be a power of two). One event is posted
+ * per completed measurement pass, so even a slow main loop only ever
+ * sees a couple of entries in flight.
+ */
+#define QUICKTUNE_CONTROL_QUEUE_LEN     8
+
+/**
+ * Length of the SPSC queue carrying ISR-raised events to the
+ * registered QuickTune_SetEventCallback() handler (must be a power of
+ * two). Sized for the burstiest producer - ten band-complete events
+ * plus the surrounding state changes in one pass.
+ */
+#define QUICKTUNE_EVENT_QUEUE_LEN       16
+
+/* ============================================================================
+ * MULTI-POSITION CALIBRATION
+ * ============================================================================ */
+
+/**
+ * Maximum mic positions per spatial-averaging calibration. The merge is
+ * incremental (one weighted power average, O(bands) memory), so this
+ * bounds only the per-position weight array, not stored spectra.
+ */
+#define QUICKTUNE_MAX_POSITIONS         8
+
 /* ============================================================================
  * TONE GENERATION
  * ============================================================================ */
@@ -128,6 +598,25 @@ static const float QUICKTUNE_MEMS_CALIBRATION[QUICKTUNE_NUM_BANDS] = {
 /** Fade in/out duration (samples) - 10 ms to reduce clicks */
 #define QUICKTUNE_FADE_SAMPLES          480  // 10 ms @ 48 kHz
 
+/* ============================================================================
+ * PROFILING
+ * ============================================================================ */
+
+/** CPU core clock (Hz) - used to convert cycle counts to CPU percentage */
+#define QUICKTUNE_CPU_HZ                250000000
+
+/** CPU cycles per 32-sample block period (667 µs @ 250 MHz) */
+#define QUICKTUNE_CYCLES_PER_BLOCK      ((uint32_t)((uint64_t)QUICKTUNE_CPU_HZ * QUICKTUNE_BLOCK_SIZE / QUICKTUNE_SAMPLE_RATE))
+
+/**
+ * Enable DWT cycle-counter instrumentation of the hot path
+ * (see quicktune_profile.h). Set to 0 for release builds to compile
+ * the instrumentation out entirely.
+ */
+#ifndef QUICKTUNE_ENABLE_PROFILING
+#define QUICKTUNE_ENABLE_PROFILING      1
+#endif
+
 /* ============================================================================
  * MEMORY ALLOCATION
  * ============================================================================ */
@@ -138,8 +627,8 @@ static const float QUICKTUNE_MEMS_CALIBRATION[QUICKTUNE_NUM_BANDS] = {
 /** Size of EQ10 biquad coefficient array (5 coeffs per band) */
 #define QUICKTUNE_EQ10_COEFF_SIZE       (QUICKTUNE_NUM_BANDS * 5)
 
-/** Size of EQ10 biquad state array (2 states per band) */
-#define QUICKTUNE_EQ10_STATE_SIZE       (QUICKTUNE_NUM_BANDS * 2)
+/** Size of EQ10 biquad state array per channel (4 states per band, CMSIS DF1) */
+#define QUICKTUNE_EQ10_STATE_SIZE       (QUICKTUNE_NUM_BANDS * 4)
 
 /* ============================================================================
  * CPU BUDGET ESTIMATES
@@ -177,10 +666,10 @@ static const float QUICKTUNE_MEMS_CALIBRATION[QUICKTUNE_NUM_BANDS] = {
  * - Subtotal:            ~116 bytes
  *
  * EQ10 State:
- * - Biquad instance:     ~40 bytes (CMSIS-DSP struct)
- * - Coefficients:        200 bytes (50 floats)
- * - State array:         80 bytes (20 floats)
- * - Subtotal:            ~320 bytes
+ * - Biquad instances:    ~120 bytes (CMSIS-DSP structs, 3 channels)
+ * - Coefficients:        200 bytes (50 floats, shared across channels)
+ * - State arrays:        480 bytes (40 floats × 3 channels, CMSIS DF1)
+ * - Subtotal:            ~800 bytes
  *
  * Configuration (const):
  * - Band frequencies:    40 bytes (10 floats)
@@ -0,0 +1,186 @@
+/**
+ * @file quicktune_dma.cpp
+ * @brief Zero-copy SAI/I2S DMA integration implementation
+ *
+ * Converts between the SAI DMA sample formats and the float block
+ * buffers in a single pass each way: the mic conversion feeds the
+ * Goertzel path directly and the tone output converts straight into
+ * the TX DMA half, so the only per-sample overhead versus an all-float
+ * pipeline is the fixed-point scaling itself.
+ *
+ * @author DSP Team (Implementation Agent)
+ * @date 2026-02-09
+ * @target STM32H562 (Cortex-M33, 250 MHz)
+ *
+ * CONFIDENTIAL - Binary-only delivery
+ */
+
+#include "quicktune_dma.h"
+#include "quicktune.h"
+#include <stddef.h>
+
+/* ============================================================================
+ * PRIVATE STATE
+ * ============================================================================ */
+
+/** Attached RX (mic) DMA buffer, or NULL */
+static void* s_dma_mic_rx = NULL;
+
+/** Attached TX (speaker) DMA buffer, or NULL */
+static void* s_dma_spk_tx = NULL;
+
+/** Frames per buffer half */
+static int s_dma_half_frames = 0;
+
+/** Sample format of both buffers */
+static QuickTuneDmaFormat s_dma_format = QUICKTUNE_DMA_FORMAT_INT16;
+
+/** Samples per frame (1 = mono, 2 = interleaved stereo) */
+static int s_dma_stride = 1;
+
+/** Float block buffers the kernels consume (one block, reused per chunk) */
+static float s_dma_mic_f[QUICKTUNE_BLOCK_SIZE];
+static float s_dma_spk_f[QUICKTUNE_BLOCK_SIZE];
+
+/* ============================================================================
+ * FUSED CONVERSION PASSES
+ * ============================================================================ */
+
+/** int16 full-scale reciprocal */
+#define DMA_INT16_SCALE_IN      (1.0f / 32768.0f)
+#define DMA_INT16_SCALE_OUT     32767.0f
+
+/** int24 (right-justified in 32 bits) full-scale reciprocal */
+#define DMA_INT24_SCALE_IN      (1.0f / 8388608.0f)
+#define DMA_INT24_SCALE_OUT     8388607.0f
+
+/**
+ * @brief Convert one chunk of mic frames to float (channel 0 of each frame)
+ */
+static void Dma_ConvertIn(const void* src, float* dst, int frames)
+{
+    if (s_dma_format == QUICKTUNE_DMA_FORMAT_INT16)
+    {
+        const int16_t* s = (const int16_t*)src;
+        for (int i = 0; i < frames; i++)
+        {
+            dst[i] = (float)s[i * s_dma_stride] * DMA_INT16_SCALE_IN;
+        }
+    }
+    else
+    {
+        const int32_t* s = (const int32_t*)src;
+        for (int i = 0; i < frames; i++)
+        {
+            // Sign-extend the 24-bit payload in case the SAI leaves the
+            // top byte undefined
+            const int32_t v = (s[i * s_dma_stride] << 8) >> 8;
+            dst[i] = (float)v * DMA_INT24_SCALE_IN;
+        }
+    }
+}
+
+/**
+ * @brief Convert one chunk of float stimulus into TX frames (all channels)
+ */
+static void Dma_ConvertOut(const float* src, void* dst, int frames)
+{
+    if (s_dma_format == QUICKTUNE_DMA_FORMAT_INT16)
+    {
+        int16_t* d = (int16_t*)dst;
+        for (int i = 0; i < frames; i++)
+        {
+            float v = src[i] * DMA_INT16_SCALE_OUT;
+            if (v > DMA_INT16_SCALE_OUT)   v = DMA_INT16_SCALE_OUT;
+            if (v < -32768.0f)             v = -32768.0f;
+            const int16_t q = (int16_t)v;
+            for (int ch = 0; ch < s_dma_stride; ch++)
+            {
+                d[i * s_dma_stride + ch] = q;
+            }
+        }
+    }
+    else
+    {
+        int32_t* d = (int32_t*)dst;
+        for (int i = 0; i < frames; i++)
+        {
+            float v = src[i] * DMA_INT24_SCALE_OUT;
+            if (v > DMA_INT24_SCALE_OUT)   v = DMA_INT24_SCALE_OUT;
+            if (v < -8388608.0f)           v = -8388608.0f;
+            const int32_t q = (int32_t)v;
+            for (int ch = 0; ch < s_dma_stride; ch++)
+            {
+                d[i * s_dma_stride + ch] = q;
+            }
+        }
+    }
+}
+
+/** Bytes per frame for the attached format/stride */
+static int Dma_FrameBytes(void)
+{
+    const int sample_bytes = (s_dma_format == QUICKTUNE_DMA_FORMAT_INT16) ? 2 : 4;
+    return sample_bytes * s_dma_stride;
+}
+
+/* ============================================================================
+ * PUBLIC API IMPLEMENTATION
+ * ============================================================================ */
+
+bool QuickTune_AttachDMABuffers(void* micRx, void* spkTx, int halfFrames,
+                                QuickTuneDmaFormat format, int stride)
+{
+    if (micRx == NULL || spkTx == NULL ||
+        halfFrames <= 0 || (halfFrames % QUICKTUNE_BLOCK_SIZE) != 0 ||
+        (stride != 1 && stride != 2))
+    {
+        return false;
+    }
+
+    s_dma_mic_rx = micRx;
+    s_dma_spk_tx = spkTx;
+    s_dma_half_frames = halfFrames;
+    s_dma_format = format;
+    s_dma_stride = stride;
+
+    return true;
+}
+
+void QuickTune_DetachDMABuffers(void)
+{
+    s_dma_mic_rx = NULL;
+    s_dma_spk_tx = NULL;
+    s_dma_half_frames = 0;
+}
+
+void QuickTune_ProcessDMAHalf(int half)
+{
+    if (s_dma_mic_rx == NULL || (half != 0 && half != 1))
+    {
+        return;
+    }
+
+    const int frame_bytes = Dma_FrameBytes();
+    const int half_bytes = s_dma_half_frames * frame_bytes;
+
+    uint8_t* mic = (uint8_t*)s_dma_mic_rx + (size_t)half * half_bytes;
+    uint8_t* spk = (uint8_t*)s_dma_spk_tx + (size_t)half * half_bytes;
+
+    // The DMA wrote this half - drop any stale cache lines before reading
+    QUICKTUNE_DMA_INVALIDATE(mic, half_bytes);
+
+    for (int done = 0; done < s_dma_half_frames; done += QUICKTUNE_BLOCK_SIZE)
+    {
+        Dma_ConvertIn(mic + (size_t)done * frame_bytes, s_dma_mic_f,
+                      QUICKTUNE_BLOCK_SIZE);
+
+        QuickTune_ProcessBlock(s_dma_mic_f, s_dma_spk_f, QUICKTUNE_BLOCK_SIZE);
+
+        Dma_ConvertOut(s_dma_spk_f, spk + (size_t)done * frame_bytes,
+                       QUICKTUNE_BLOCK_SIZE);
+    }
+
+    // Push the stimulus out to memory before the DMA reads this half
+    QUICKTUNE_DMA_CLEAN(spk, half_bytes);
+}
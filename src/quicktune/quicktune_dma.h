@@ -0,0 +1,114 @@
+/**
+ * @file quicktune_dma.h
+ * @brief Zero-copy SAI/I2S DMA integration for QuickTune
+ *
+ * Lets the audio glue hand the SAI DMA ping-pong buffer halves straight
+ * to QuickTune: sample format conversion (int16 / int24-in-32) runs in
+ * a single fused pass between DMA memory and the block buffers the
+ * kernels consume, with no intermediate application-side copies, and
+ * cache maintenance hooks cover buffers placed in a DMA-coherent
+ * region behind the STM32H5 DCACHE.
+ *
+ * Usage from the SAI callbacks:
+ *   QuickTune_AttachDMABuffers(micRx, spkTx, halfFrames, fmt, stride);
+ *   // in HAL_SAI_RxHalfCpltCallback: QuickTune_ProcessDMAHalf(0);
+ *   // in HAL_SAI_RxCpltCallback:     QuickTune_ProcessDMAHalf(1);
+ *
+ * @author DSP Team (Implementation Agent)
+ * @date 2026-02-09
+ * @target STM32H562 (Cortex-M33, 250 MHz)
+ *
+ * CONFIDENTIAL - Binary-only delivery
+ */
+
+#ifndef QUICKTUNE_DMA_H
+#define QUICKTUNE_DMA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "quicktune_config.h"
+
+/* ============================================================================
+ * CACHE MAINTENANCE HOOKS
+ * ============================================================================ */
+
+/**
+ * Cache maintenance for DMA buffers behind the STM32H5 DCACHE. The
+ * defaults are no-ops (buffers in a non-cacheable MPU region, or DCACHE
+ * disabled); builds with cacheable DMA buffers override these with the
+ * CMSIS calls, e.g.:
+ *
+ *   -DQUICKTUNE_DMA_INVALIDATE(a,b)=SCB_InvalidateDCache_by_Addr((void*)(a),(b))
+ *   -DQUICKTUNE_DMA_CLEAN(a,b)=SCB_CleanDCache_by_Addr((void*)(a),(b))
+ */
+#ifndef QUICKTUNE_DMA_INVALIDATE
+#define QUICKTUNE_DMA_INVALIDATE(addr, bytes)   ((void)0)
+#endif
+
+#ifndef QUICKTUNE_DMA_CLEAN
+#define QUICKTUNE_DMA_CLEAN(addr, bytes)        ((void)0)
+#endif
+
+/* ============================================================================
+ * PUBLIC API
+ * ============================================================================ */
+
+/**
+ * @brief DMA sample format
+ */
+typedef enum {
+    QUICKTUNE_DMA_FORMAT_INT16,     /**< 16-bit signed samples */
+    QUICKTUNE_DMA_FORMAT_INT24      /**< 24-bit signed, right-justified in 32-bit words */
+} QuickTuneDmaFormat;
+
+/**
+ * @brief Attach the SAI DMA ping-pong buffers
+ *
+ * Registers the RX (mic) and TX (speaker) DMA buffers. Each buffer
+ * holds two halves of halfFrames frames; a frame is stride samples
+ * (1 = mono, 2 = interleaved stereo). The mic is taken from channel 0
+ * of each frame and the stimulus is written to every channel.
+ *
+ * @param micRx Mic RX DMA buffer (2 * halfFrames * stride samples)
+ * @param spkTx Speaker TX DMA buffer (same layout)
+ * @param halfFrames Frames per buffer half - must be a multiple of
+ *                   QUICKTUNE_BLOCK_SIZE
+ * @param format Sample format of both buffers
+ * @param stride Samples per frame (1 = mono, 2 = interleaved stereo)
+ *
+ * @return true if attached, false on invalid parameters
+ */
+bool QuickTune_AttachDMABuffers(void* micRx, void* spkTx, int halfFrames,
+                                QuickTuneDmaFormat format, int stride);
+
+/**
+ * @brief Detach the DMA buffers
+ *
+ * Subsequent QuickTune_ProcessDMAHalf() calls become no-ops.
+ */
+void QuickTune_DetachDMABuffers(void);
+
+/**
+ * @brief Process one DMA buffer half
+ *
+ * Call from the SAI half-transfer (half = 0) and transfer-complete
+ * (half = 1) callbacks. Invalidates the mic half, runs the conversion
+ * and QuickTune_ProcessBlock() in QUICKTUNE_BLOCK_SIZE chunks, writes
+ * the stimulus back into the TX half and cleans it for the DMA.
+ *
+ * Per-frame cost on top of the QuickTune block path is the fixed-point
+ * conversion only (~2 cycles/sample each way) - no buffer copies.
+ *
+ * @param half Buffer half to process (0 or 1)
+ */
+void QuickTune_ProcessDMAHalf(int half);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QUICKTUNE_DMA_H */
@@ -41,7 +41,9 @@ void Example1_Init(void)
  */
 void Example1_StartCalibration(void)
 {
-    if (QuickTune_Start())
+    // Parallel multi-tone mode: all 10 bands measured at once (~1.2 s total).
+    // Use QUICKTUNE_MODE_SEQUENTIAL for the stepped-tone fallback (~9 s).
+    if (QuickTune_Start(QUICKTUNE_MODE_PARALLEL))
     {
         printf("Calibration started...\n");
     }
@@ -288,7 +290,7 @@ void Example6_CompleteApplication(void)
 
     // Step 3: User presses "Calibrate" button
     printf("\nStep 3: User presses calibrate button...\n");
-    if (QuickTune_Start())
+    if (QuickTune_Start(QUICKTUNE_MODE_PARALLEL))
     {
         printf("Calibration started\n");
     }
@@ -481,6 +483,78 @@ void Example8_RealTimeProcessing(float* input, float* output, int numSamples)
     }
 }
 
+/* ============================================================================
+ * EXAMPLE 9: Event-Driven Integration (No Polling)
+ * ============================================================================ */
+
+/**
+ * @brief Handle calibration events from the control context
+ *
+ * Replaces the polling in Example 2: instead of reading
+ * QuickTune_GetState() every few ms, register this callback once and
+ * let the main loop sleep (WFI) between QuickTune_ControlTask() runs.
+ * The callback runs in the control context, so slow work like the
+ * flash write below is safe here.
+ */
+static void Example9_OnEvent(QuickTuneEventType type, uint32_t data, void* context)
+{
+    (void)context;
+
+    switch (type)
+    {
+        case QUICKTUNE_EVENT_BAND_COMPLETE:
+            printf("Band %lu/10 measured\n", (unsigned long)data + 1);
+            // LED_SetBrightness((uint8_t)((data + 1) * 25));
+            break;
+
+        case QUICKTUNE_EVENT_ITERATION_COMPLETE:
+            printf("Refinement pass %lu complete\n", (unsigned long)data + 1);
+            break;
+
+        case QUICKTUNE_EVENT_STATE_CHANGE:
+            if ((QuickTuneState)data == QUICKTUNE_STATE_DONE)
+            {
+                printf("Calibration complete - saving preset\n");
+
+                // Safe here: control context, not the audio ISR
+                uint8_t preset[QUICKTUNE_PRESET_SIZE];
+                if (QuickTune_SavePreset(preset))
+                {
+                    // Flash_WritePreset(preset, sizeof(preset));
+                }
+            }
+            break;
+
+        case QUICKTUNE_EVENT_ERROR:
+            printf("Calibration error %lu\n", (unsigned long)data);
+            break;
+    }
+}
+
+/**
+ * @brief Event-driven main loop: sleeps instead of polling
+ */
+void Example9_EventDrivenLoop(void)
+{
+    QuickTune_SetEventCallback(Example9_OnEvent, NULL);
+    QuickTune_Start(QUICKTUNE_MODE_SEQUENTIAL);
+
+    for (;;)
+    {
+        // Drains ISR events and delivers callbacks; nothing else to do
+        QuickTune_ControlTask();
+
+        if (QuickTune_GetState() == QUICKTUNE_STATE_DONE)
+        {
+            break;
+        }
+
+        // __WFI();  // Sleep until the next audio interrupt
+    }
+
+    QuickTune_SetEventCallback(NULL, NULL);
+}
+
 /* ============================================================================
  * MAIN (for testing on desktop)
  * ============================================================================ */
@@ -0,0 +1,132 @@
+/**
+ * @file quicktune_profile.h
+ * @brief Cycle-Accurate Hot-Path Profiling (DWT CYCCNT)
+ *
+ * Lightweight instrumentation for the audio hot path. On target the
+ * Cortex-M33 DWT cycle counter is sampled around the block processing
+ * functions; min/avg/max and a worst-case watermark are accumulated per
+ * counter. Measurement overhead is two register reads plus a handful of
+ * compares (~15 cycles per block).
+ *
+ * Compile out for release builds with -DQUICKTUNE_ENABLE_PROFILING=0;
+ * the instrumentation then costs nothing and QuickTune_GetPerfStats()
+ * reports no data.
+ *
+ * On non-ARM host builds the cycle source reads as zero - host-side
+ * throughput measurement belongs to the benchmark harness instead.
+ *
+ * @author DSP Team (Implementation Agent)
+ * @date 2026-02-09
+ * @target STM32H562 (Cortex-M33, 250 MHz)
+ *
+ * CONFIDENTIAL - Binary-only delivery
+ */
+
+#ifndef QUICKTUNE_PROFILE_H
+#define QUICKTUNE_PROFILE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "quicktune_config.h"
+
+#if QUICKTUNE_ENABLE_PROFILING
+
+/* ============================================================================
+ * CYCLE SOURCE
+ * ============================================================================ */
+
+#ifdef ARM_MATH_CM33
+
+/* DWT cycle counter registers (CoreDebug + DWT) */
+#define QTPROF_DEMCR            (*(volatile uint32_t*)0xE000EDFC)
+#define QTPROF_DWT_CTRL         (*(volatile uint32_t*)0xE0001000)
+#define QTPROF_DWT_CYCCNT       (*(volatile uint32_t*)0xE0001004)
+
+/**
+ * @brief Enable the DWT cycle counter (call once at startup)
+ */
+static inline void QTProf_Init(void)
+{
+    QTPROF_DEMCR |= (1u << 24);     /* TRCENA */
+    QTPROF_DWT_CYCCNT = 0;
+    QTPROF_DWT_CTRL |= 1u;          /* CYCCNTENA */
+}
+
+/**
+ * @brief Read the free-running cycle counter
+ */
+static inline uint32_t QTProf_Cycles(void)
+{
+    return QTPROF_DWT_CYCCNT;
+}
+
+#else
+
+static inline void QTProf_Init(void)
+{
+}
+
+static inline uint32_t QTProf_Cycles(void)
+{
+    return 0;
+}
+
+#endif /* ARM_MATH_CM33 */
+
+/* ============================================================================
+ * COUNTERS
+ * ============================================================================ */
+
+/**
+ * @brief Raw accumulation counter for one instrumented section
+ */
+typedef struct
+{
+    uint32_t min_cycles;    /**< Best observed block */
+    uint32_t max_cycles;    /**< Worst-case watermark */
+    uint64_t total_cycles;  /**< Sum for average computation */
+    uint32_t count;         /**< Number of measured blocks */
+} QTProf_Counter;
+
+/**
+ * @brief Reset one counter
+ */
+static inline void QTProf_Reset(QTProf_Counter* c)
+{
+    c->min_cycles = 0xFFFFFFFFu;
+    c->max_cycles = 0;
+    c->total_cycles = 0;
+    c->count = 0;
+}
+
+/**
+ * @brief Fold one measurement into a counter (~10 cycles)
+ */
+static inline void QTProf_Update(QTProf_Counter* c, uint32_t cycles)
+{
+    if (cycles < c->min_cycles)
+    {
+        c->min_cycles = cycles;
+    }
+    if (cycles > c->max_cycles)
+    {
+        c->max_cycles = cycles;
+    }
+    c->total_cycles += cycles;
+    c->count++;
+}
+
+#else /* !QUICKTUNE_ENABLE_PROFILING */
+
+/* Profiling compiled out - no counters, zero overhead */
+
+#endif /* QUICKTUNE_ENABLE_PROFILING */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QUICKTUNE_PROFILE_H */
@@ -0,0 +1,519 @@
+/**
+ * @file quicktune_tables.h
+ * @brief Compile-time coefficient and window tables (C++14 constexpr)
+ *
+ * Moves the transcendental math out of the init paths: the flat EQ10
+ * response, the Goertzel coefficients and the analysis/monitor window
+ * lengths are all functions of the compile-time band frequencies, so
+ * they are generated here as constexpr tables and init becomes a
+ * memcpy/lookup. The boot-to-audio budget is 15 ms; powf/sinf/cosf at
+ * startup were the largest avoidable slice of it.
+ *
+ * Also provides the general facility: QTCT_DesignBiquad() mirrors
+ * EQ10_DesignBiquad() (RBJ peaking, CMSIS sign convention) in constexpr
+ * double math, and EQ10_ENABLE_COEFF_GRID expands it over the quantized
+ * gain range for zero-transcendental runtime gain changes.
+ *
+ * C++ only - include from translation units, not from the extern "C"
+ * public headers.
+ *
+ * @author DSP Team (Implementation Agent)
+ * @date 2026-02-09
+ * @target STM32H562 (Cortex-M33, 250 MHz)
+ *
+ * CONFIDENTIAL - Binary-only delivery
+ */
+
+#ifndef QUICKTUNE_TABLES_H
+#define QUICKTUNE_TABLES_H
+
+#ifndef __cplusplus
+#error "quicktune_tables.h is C++ only"
+#endif
+
+#include <stdint.h>
+#include "quicktune_config.h"
+
+/* ============================================================================
+ * CONSTEXPR MATH (double precision)
+ * ============================================================================ */
+
+/**
+ * Taylor-series elementary functions, evaluated in double at compile
+ * time. All arguments in this module are small (w0 < 0.5 rad for every
+ * band, |x| < 0.7 for the gain exponentials), so the series converge to
+ * full double precision well before the term counts used here; the
+ * range reduction is defensive.
+ */
+
+constexpr double QTCT_PI = 3.14159265358979323846;
+constexpr double QTCT_LN10 = 2.30258509299404568402;
+
+constexpr double QTCT_SinReduced(double x)
+{
+    // x in [-pi, pi]
+    double term = x;
+    double sum = x;
+    const double x2 = x * x;
+    for (int n = 1; n <= 10; n++)
+    {
+        term *= -x2 / (double)((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double QTCT_Sin(double x)
+{
+    while (x > QTCT_PI)  { x -= 2.0 * QTCT_PI; }
+    while (x < -QTCT_PI) { x += 2.0 * QTCT_PI; }
+    return QTCT_SinReduced(x);
+}
+
+constexpr double QTCT_Cos(double x)
+{
+    return QTCT_Sin(x + 0.5 * QTCT_PI);
+}
+
+constexpr double QTCT_Exp(double x)
+{
+    double term = 1.0;
+    double sum = 1.0;
+    for (int n = 1; n <= 20; n++)
+    {
+        term *= x / (double)n;
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double QTCT_Pow10(double x)
+{
+    return QTCT_Exp(x * QTCT_LN10);
+}
+
+constexpr double QTCT_Ln(double x)
+{
+    // Decade range reduction, then artanh series: ln(x) = 2*artanh((x-1)/(x+1))
+    int decades = 0;
+    while (x >= 10.0) { x /= 10.0; decades++; }
+    while (x < 1.0)   { x *= 10.0; decades--; }
+    const double t = (x - 1.0) / (x + 1.0);
+    const double t2 = t * t;
+    double term = t;
+    double sum = 0.0;
+    for (int n = 0; n < 60; n++)
+    {
+        sum += term / (double)(2 * n + 1);
+        term *= t2;
+    }
+    return 2.0 * sum + (double)decades * QTCT_LN10;
+}
+
+/* ============================================================================
+ * COMPILE-TIME FILTER DESIGN
+ * ============================================================================ */
+
+/** One biquad coefficient set in CMSIS layout [b0, b1, b2, -a1, -a2] */
+struct QTCT_Biquad
+{
+    float c[5];
+};
+
+/**
+ * @brief Design a parametric EQ biquad at compile time
+ *
+ * Mirrors EQ10_DesignBiquad() (RBJ cookbook peaking EQ, a0-normalized,
+ * feedback coefficients negated for the CMSIS cascades) in constexpr
+ * double math.
+ *
+ * @param fc Center frequency (Hz)
+ * @param gain_dB Gain in dB
+ * @param Q Quality factor
+ * @param fs Sample rate (Hz)
+ */
+constexpr QTCT_Biquad QTCT_DesignBiquad(double fc, double gain_dB, double Q, double fs)
+{
+    const double A = QTCT_Pow10(gain_dB / 40.0);
+    const double w0 = 2.0 * QTCT_PI * fc / fs;
+    const double sin_w0 = QTCT_Sin(w0);
+    const double cos_w0 = QTCT_Cos(w0);
+    const double alpha = sin_w0 / (2.0 * Q);
+
+    const double b0 = 1.0 + alpha * A;
+    const double b1 = -2.0 * cos_w0;
+    const double b2 = 1.0 - alpha * A;
+    const double a0 = 1.0 + alpha / A;
+    const double a1 = -2.0 * cos_w0;
+    const double a2 = 1.0 - alpha / A;
+
+    return QTCT_Biquad{ {
+        (float)(b0 / a0),
+        (float)(b1 / a0),
+        (float)(b2 / a0),
+        (float)(-a1 / a0),
+        (float)(-a2 / a0)
+    } };
+}
+
+/**
+ * @brief Goertzel coefficient 2*cos(2*pi*k/N) for fc over an N-sample window
+ *
+ * Uses the same bin expression as the runtime Goertzel_Init().
+ */
+constexpr float QTCT_GoertzelCoeff(double fc, int num_samples, double fs)
+{
+    const double k = (double)(float)((float)num_samples * (float)fc / (float)fs + 0.5f);
+    const double w = (2.0 * QTCT_PI * k) / (double)num_samples;
+    return (float)(2.0 * QTCT_Cos(w));
+}
+
+/**
+ * @brief Whole-cycle window length: >= min_samples, integer cycles of fc
+ *
+ * Matches the runtime ceilf-based sizing in StartBandMeasurement() and
+ * QuickTune_StartMonitoring().
+ */
+constexpr uint32_t QTCT_WholeCycleWindow(double fc, int min_samples, double fs)
+{
+    const double exact = (double)min_samples * fc / fs;
+    int cycles = (int)exact;
+    if ((double)cycles < exact)
+    {
+        cycles++;
+    }
+    return (uint32_t)((double)cycles * fs / fc + 0.5);
+}
+
+/* ============================================================================
+ * GENERATED TABLES
+ * ============================================================================ */
+
+/** Flat EQ10 coefficient bank (all bands 0 dB) in one contiguous block */
+struct QTCT_CoeffBank
+{
+    float c[QUICKTUNE_NUM_BANDS * 5];
+};
+
+constexpr QTCT_CoeffBank QTCT_MakeFlatBank()
+{
+    QTCT_CoeffBank bank{};
+    for (int band = 0; band < QUICKTUNE_NUM_BANDS; band++)
+    {
+        const QTCT_Biquad bq = QTCT_DesignBiquad(QUICKTUNE_BAND_FREQUENCIES[band],
+                                                 0.0, QUICKTUNE_EQ_Q,
+                                                 QUICKTUNE_SAMPLE_RATE);
+        for (int i = 0; i < 5; i++)
+        {
+            bank.c[band * 5 + i] = bq.c[i];
+        }
+    }
+    return bank;
+}
+
+/** Flat-response boot table: EQ10_Init() memcpys this into bank 0 */
+constexpr QTCT_CoeffBank QTCT_EQ10_FLAT = QTCT_MakeFlatBank();
+
+/** Per-band table generator for Goertzel coefficients over a fixed window */
+struct QTCT_BandFloats
+{
+    float v[QUICKTUNE_NUM_BANDS];
+};
+
+struct QTCT_BandWindows
+{
+    uint32_t v[QUICKTUNE_NUM_BANDS];
+};
+
+constexpr QTCT_BandFloats QTCT_MakeGoertzelCoeffs(int num_samples)
+{
+    QTCT_BandFloats t{};
+    for (int band = 0; band < QUICKTUNE_NUM_BANDS; band++)
+    {
+        t.v[band] = QTCT_GoertzelCoeff(QUICKTUNE_BAND_FREQUENCIES[band],
+                                       num_samples, QUICKTUNE_SAMPLE_RATE);
+    }
+    return t;
+}
+
+constexpr QTCT_BandWindows QTCT_MakeWholeCycleWindows(int min_samples)
+{
+    QTCT_BandWindows t{};
+    for (int band = 0; band < QUICKTUNE_NUM_BANDS; band++)
+    {
+        t.v[band] = QTCT_WholeCycleWindow(QUICKTUNE_BAND_FREQUENCIES[band],
+                                          min_samples, QUICKTUNE_SAMPLE_RATE);
+    }
+    return t;
+}
+
+/** Goertzel coefficients for the fixed sequential analysis window */
+constexpr QTCT_BandFloats QTCT_GOERTZEL_SEQ =
+    QTCT_MakeGoertzelCoeffs(QUICKTUNE_TONE_ANALYSIS_SAMPLES);
+
+/** Adaptive-analysis chunk windows (whole cycles) and their Goertzel coefficients */
+constexpr QTCT_BandWindows QTCT_CHUNK_WINDOWS =
+    QTCT_MakeWholeCycleWindows(QUICKTUNE_ANALYSIS_CHUNK_SAMPLES);
+
+constexpr QTCT_BandFloats QTCT_MakeChunkCoeffs()
+{
+    QTCT_BandFloats t{};
+    for (int band = 0; band < QUICKTUNE_NUM_BANDS; band++)
+    {
+        t.v[band] = QTCT_GoertzelCoeff(QUICKTUNE_BAND_FREQUENCIES[band],
+                                       (int)QTCT_CHUNK_WINDOWS.v[band],
+                                       QUICKTUNE_SAMPLE_RATE);
+    }
+    return t;
+}
+
+constexpr QTCT_BandFloats QTCT_CHUNK_COEFFS = QTCT_MakeChunkCoeffs();
+
+/**
+ * Harmonic detector coefficients over the same chunk windows, on EXACT
+ * integer bins k = harmonic * cycles (rub & buzz capture,
+ * QUICKTUNE_HARMONIC_CAPTURE). The chunk window is whole cycles of the
+ * fundamental, so the fundamental has near-zero leakage at the exact
+ * harmonic bins; the level detector's half-bin offset convention
+ * (QTCT_GoertzelCoeff) would instead leak the fundamental straight into
+ * them. harmonic = 1 gives the exact fundamental bin used as the THD
+ * reference.
+ */
+constexpr float QTCT_GoertzelHarmonicCoeff(double fc, int harmonic, int min_samples, double fs)
+{
+    const double exact = (double)min_samples * fc / fs;
+    int cycles = (int)exact;
+    if ((double)cycles < exact)
+    {
+        cycles++;
+    }
+    const int num_samples = (int)QTCT_WholeCycleWindow(fc, min_samples, fs);
+    const double w = (2.0 * QTCT_PI * (double)(harmonic * cycles)) / (double)num_samples;
+    return (float)(2.0 * QTCT_Cos(w));
+}
+
+constexpr QTCT_BandFloats QTCT_MakeChunkHarmonicCoeffs(int harmonic)
+{
+    QTCT_BandFloats t{};
+    for (int band = 0; band < QUICKTUNE_NUM_BANDS; band++)
+    {
+        t.v[band] = QTCT_GoertzelHarmonicCoeff(QUICKTUNE_BAND_FREQUENCIES[band], harmonic,
+                                               QUICKTUNE_ANALYSIS_CHUNK_SAMPLES,
+                                               QUICKTUNE_SAMPLE_RATE);
+    }
+    return t;
+}
+
+constexpr QTCT_BandFloats QTCT_CHUNK_COEFFS_H1 = QTCT_MakeChunkHarmonicCoeffs(1);
+constexpr QTCT_BandFloats QTCT_CHUNK_COEFFS_H2 = QTCT_MakeChunkHarmonicCoeffs(2);
+constexpr QTCT_BandFloats QTCT_CHUNK_COEFFS_H3 = QTCT_MakeChunkHarmonicCoeffs(3);
+
+#if QUICKTUNE_ADAPTIVE_ANALYSIS && QUICKTUNE_DECIMATED_ANALYSIS
+
+/**
+ * Decimated analysis path (QUICKTUNE_DECIMATED_ANALYSIS): chunk windows
+ * and detector coefficients at the low rate (fs / QUICKTUNE_DECIM_FACTOR),
+ * plus the anti-alias FIR. Windows are whole cycles of fc at the LOW
+ * rate with the same minimum chunk duration as the full-rate tables
+ * (QUICKTUNE_ANALYSIS_CHUNK_SAMPLES / factor), so per-band measurement
+ * time is unchanged. Entries exist for all bands; only those below
+ * QUICKTUNE_DECIM_CROSSOVER_HZ are used.
+ */
+
+constexpr double QTCT_DECIM_RATE =
+    (double)QUICKTUNE_SAMPLE_RATE / (double)QUICKTUNE_DECIM_FACTOR;
+
+constexpr int QTCT_DECIM_MIN_CHUNK =
+    QUICKTUNE_ANALYSIS_CHUNK_SAMPLES / QUICKTUNE_DECIM_FACTOR;
+
+constexpr QTCT_BandWindows QTCT_MakeDecimWindows()
+{
+    QTCT_BandWindows t{};
+    for (int band = 0; band < QUICKTUNE_NUM_BANDS; band++)
+    {
+        t.v[band] = QTCT_WholeCycleWindow(QUICKTUNE_BAND_FREQUENCIES[band],
+                                          QTCT_DECIM_MIN_CHUNK, QTCT_DECIM_RATE);
+    }
+    return t;
+}
+
+constexpr QTCT_BandWindows QTCT_DECIM_WINDOWS = QTCT_MakeDecimWindows();
+
+constexpr QTCT_BandFloats QTCT_MakeDecimCoeffs()
+{
+    QTCT_BandFloats t{};
+    for (int band = 0; band < QUICKTUNE_NUM_BANDS; band++)
+    {
+        t.v[band] = QTCT_GoertzelCoeff(QUICKTUNE_BAND_FREQUENCIES[band],
+                                       (int)QTCT_DECIM_WINDOWS.v[band],
+                                       QTCT_DECIM_RATE);
+    }
+    return t;
+}
+
+constexpr QTCT_BandFloats QTCT_DECIM_COEFFS = QTCT_MakeDecimCoeffs();
+
+constexpr QTCT_BandFloats QTCT_MakeDecimHarmonicCoeffs(int harmonic)
+{
+    QTCT_BandFloats t{};
+    for (int band = 0; band < QUICKTUNE_NUM_BANDS; band++)
+    {
+        t.v[band] = QTCT_GoertzelHarmonicCoeff(QUICKTUNE_BAND_FREQUENCIES[band], harmonic,
+                                               QTCT_DECIM_MIN_CHUNK, QTCT_DECIM_RATE);
+    }
+    return t;
+}
+
+constexpr QTCT_BandFloats QTCT_DECIM_COEFFS_H1 = QTCT_MakeDecimHarmonicCoeffs(1);
+constexpr QTCT_BandFloats QTCT_DECIM_COEFFS_H2 = QTCT_MakeDecimHarmonicCoeffs(2);
+constexpr QTCT_BandFloats QTCT_DECIM_COEFFS_H3 = QTCT_MakeDecimHarmonicCoeffs(3);
+
+/** Anti-alias FIR taps (Hamming windowed sinc, unity DC gain) */
+struct QTCT_DecimFir
+{
+    float c[QUICKTUNE_DECIM_NUM_TAPS];
+};
+
+constexpr QTCT_DecimFir QTCT_MakeDecimFir()
+{
+    QTCT_DecimFir f{};
+    const int N = QUICKTUNE_DECIM_NUM_TAPS;
+    const double fc = QUICKTUNE_DECIM_FIR_CUTOFF_HZ / (double)QUICKTUNE_SAMPLE_RATE;
+
+    double sum = 0.0;
+    for (int n = 0; n < N; n++)
+    {
+        const double m = (double)n - 0.5 * (double)(N - 1);
+        // sinc lowpass; the m = 0 midpoint only occurs for odd N
+        const double x = 2.0 * QTCT_PI * fc * m;
+        const double sinc = (m == 0.0) ? 2.0 * fc
+                                       : QTCT_Sin(x) / (QTCT_PI * m);
+        const double window = 0.54 - 0.46 * QTCT_Cos(2.0 * QTCT_PI * (double)n
+                                                     / (double)(N - 1));
+        f.c[n] = (float)(sinc * window);
+        sum += sinc * window;
+    }
+    // Normalize to exactly unity DC gain so decimated levels match the
+    // full-rate path
+    for (int n = 0; n < N; n++)
+    {
+        f.c[n] = (float)((double)f.c[n] / sum);
+    }
+    return f;
+}
+
+constexpr QTCT_DecimFir QTCT_DECIM_FIR = QTCT_MakeDecimFir();
+
+#endif /* QUICKTUNE_ADAPTIVE_ANALYSIS && QUICKTUNE_DECIMATED_ANALYSIS */
+
+/** Background monitor windows (whole cycles) and their Goertzel coefficients */
+constexpr QTCT_BandWindows QTCT_MONITOR_WINDOWS =
+    QTCT_MakeWholeCycleWindows(QUICKTUNE_MONITOR_WINDOW_SAMPLES);
+
+constexpr QTCT_BandFloats QTCT_MakeMonitorCoeffs()
+{
+    QTCT_BandFloats t{};
+    for (int band = 0; band < QUICKTUNE_NUM_BANDS; band++)
+    {
+        t.v[band] = QTCT_GoertzelCoeff(QUICKTUNE_BAND_FREQUENCIES[band],
+                                       (int)QTCT_MONITOR_WINDOWS.v[band],
+                                       QUICKTUNE_SAMPLE_RATE);
+    }
+    return t;
+}
+
+constexpr QTCT_BandFloats QTCT_MONITOR_COEFFS = QTCT_MakeMonitorCoeffs();
+
+#if QUICKTUNE_DIAG_CAPTURE
+
+/** Diagnostic spectrum bins, log-spaced QUICKTUNE_DIAG_MIN_HZ..MAX_HZ */
+struct QTCT_DiagFloats
+{
+    float v[QUICKTUNE_DIAG_BINS];
+};
+
+constexpr QTCT_DiagFloats QTCT_MakeDiagCoeffs()
+{
+    QTCT_DiagFloats t{};
+    // Geometric frequency ladder built by cumulative multiplication so
+    // the QTCT_Exp argument stays small (one bin step, ~0.07)
+    const double step = QTCT_Exp(QTCT_Ln(QUICKTUNE_DIAG_MAX_HZ /
+                                         QUICKTUNE_DIAG_MIN_HZ)
+                                 / (double)(QUICKTUNE_DIAG_BINS - 1));
+    double fc = QUICKTUNE_DIAG_MIN_HZ;
+    for (int bin = 0; bin < QUICKTUNE_DIAG_BINS; bin++)
+    {
+        t.v[bin] = QTCT_GoertzelCoeff(fc, QUICKTUNE_DIAG_WINDOW_SAMPLES,
+                                      QUICKTUNE_SAMPLE_RATE);
+        fc *= step;
+    }
+    return t;
+}
+
+constexpr QTCT_DiagFloats QTCT_DIAG_COEFFS = QTCT_MakeDiagCoeffs();
+
+#endif /* QUICKTUNE_DIAG_CAPTURE */
+
+/* ============================================================================
+ * OPTIONAL GAIN GRID (EQ10_ENABLE_COEFF_GRID)
+ * ============================================================================ */
+
+#if EQ10_ENABLE_COEFF_GRID
+
+/** Grid steps across the +/-12 dB range at EQ10_COEFF_GRID_STEP_DB */
+#define QTCT_GRID_STEPS \
+    ((int)((QUICKTUNE_MAX_GAIN_DB - QUICKTUNE_MIN_GAIN_DB) / EQ10_COEFF_GRID_STEP_DB) + 1)
+
+struct QTCT_CoeffGrid
+{
+    float c[QUICKTUNE_NUM_BANDS][QTCT_GRID_STEPS][5];
+};
+
+constexpr QTCT_CoeffGrid QTCT_MakeCoeffGrid()
+{
+    QTCT_CoeffGrid grid{};
+    for (int band = 0; band < QUICKTUNE_NUM_BANDS; band++)
+    {
+        for (int step = 0; step < QTCT_GRID_STEPS; step++)
+        {
+            const double gain_dB = (double)QUICKTUNE_MIN_GAIN_DB +
+                                   (double)step * (double)EQ10_COEFF_GRID_STEP_DB;
+            const QTCT_Biquad bq = QTCT_DesignBiquad(QUICKTUNE_BAND_FREQUENCIES[band],
+                                                     gain_dB, QUICKTUNE_EQ_Q,
+                                                     QUICKTUNE_SAMPLE_RATE);
+            for (int i = 0; i < 5; i++)
+            {
+                grid.c[band][step][i] = bq.c[i];
+            }
+        }
+    }
+    return grid;
+}
+
+/** Fixed-Q designs over the quantized gain range (~10 KB of flash) */
+constexpr QTCT_CoeffGrid QTCT_EQ10_GRID = QTCT_MakeCoeffGrid();
+
+/**
+ * @brief Look up the precomputed biquad nearest to gain_dB
+ *
+ * @param band Band index (0-9)
+ * @param gain_dB Gain in dB (clipped to the grid range)
+ * @return Pointer to 5 coefficients in CMSIS layout
+ */
+inline const float* QTCT_GridLookup(int band, float gain_dB)
+{
+    int step = (int)((gain_dB - QUICKTUNE_MIN_GAIN_DB) / EQ10_COEFF_GRID_STEP_DB + 0.5f);
+    if (step < 0)
+    {
+        step = 0;
+    }
+    if (step >= QTCT_GRID_STEPS)
+    {
+        step = QTCT_GRID_STEPS - 1;
+    }
+    return QTCT_EQ10_GRID.c[band][step];
+}
+
+#endif /* EQ10_ENABLE_COEFF_GRID */
+
+#endif /* QUICKTUNE_TABLES_H */
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""
+Goertzel Detector Precision Validation
+======================================
+
+Quantifies the accuracy gain of the precision-configurable Goertzel
+detector (QUICKTUNE_GOERTZEL_F64 in quicktune_config.h) against a
+long-double reference, per band.
+
+Three schemes are compared over the 4800-sample sequential analysis
+window, matching the embedded implementation:
+
+- f32/f32:  f32 recurrence, f32 finalize (legacy detector)
+- f32/f64:  f32 recurrence, f64 finalize (parallel/diagnostic banks -
+            the shared finalize helper always computes the power
+            difference in f64)
+- f64/f64:  f64 recurrence and finalize (sequential detector default)
+
+The finalize step power = s1^2 + s2^2 - coeff*s1*s2 cancels
+catastrophically for a strong in-band signal: s1/s2 grow to ~N*A/2
+while the difference stays ~(N*A/2)^2 * sin^2(w), so an f32 subtraction
+loses most of its significand at low bands where sin(w) is small.
+
+Author: DSP Team (Validation Agent)
+Date: 2026-08-26
+"""
+
+import numpy as np
+
+# ============================================================================
+# CONSTANTS (matching embedded implementation)
+# ============================================================================
+
+FS = 48000
+NUM_BANDS = 10
+BAND_FREQS = np.array([25, 40, 63, 100, 160, 250, 400, 630, 1000, 1600])
+ANALYSIS_SAMPLES = 4800  # 100 ms sequential analysis window
+
+# Room gains to sweep per band: the detector must stay accurate across
+# the full correction range
+TEST_LEVELS_DB = [-12.0, -6.0, 0.0, 6.0, 12.0]
+TONE_AMPLITUDE = 0.5
+NOISE_AMPLITUDE = 1e-4  # ~-80 dBFS mic noise floor
+
+# Pass criteria (dB worst-case detector error vs long-double reference)
+F64_MAX_ERROR_DB = 0.001
+F32_FINALIZE_GAIN_REQUIRED = 2.0  # f32/f64 must beat f32/f32 by this factor
+
+
+def goertzel(x, coeff, state_dtype, finalize_dtype):
+    """Run the Goertzel recurrence and finalize in the given precisions."""
+    c = state_dtype(coeff)
+    s1 = state_dtype(0.0)
+    s2 = state_dtype(0.0)
+    for sample in x.astype(state_dtype):
+        s0 = c * s1 - s2 + sample
+        s2 = s1
+        s1 = s0
+
+    f1 = finalize_dtype(s1)
+    f2 = finalize_dtype(s2)
+    fc = finalize_dtype(coeff)
+    power = f1 * f1 + f2 * f2 - fc * f1 * f2
+    if power <= 0.0:
+        return 0.0
+    mag = np.sqrt(finalize_dtype(2.0) * power) / finalize_dtype(ANALYSIS_SAMPLES)
+    return 20.0 * np.log10(float(mag))
+
+
+def main():
+    print("=" * 72)
+    print("Goertzel Detector Precision Validation")
+    print("=" * 72)
+    print(f"Window: {ANALYSIS_SAMPLES} samples, levels: {TEST_LEVELS_DB} dB")
+    print()
+    print(f"{'Band':>6} {'f32/f32':>10} {'f32/f64':>10} {'f64/f64':>12}   (worst |error| dB)")
+
+    rng = np.random.default_rng(20260826)
+    worst = {"f32/f32": 0.0, "f32/f64": 0.0, "f64/f64": 0.0}
+    all_pass = True
+
+    for band in range(NUM_BANDS):
+        # Exact-bin frequency, like the precomputed coefficient tables
+        # (round-half-up, matching the embedded +0.5 truncation)
+        k = int(ANALYSIS_SAMPLES * BAND_FREQS[band] / FS + 0.5)
+        w = 2.0 * np.pi * k / ANALYSIS_SAMPLES
+        coeff = 2.0 * np.cos(w)
+
+        errs = {"f32/f32": 0.0, "f32/f64": 0.0, "f64/f64": 0.0}
+        for level_db in TEST_LEVELS_DB:
+            amp = TONE_AMPLITUDE * 10.0 ** (level_db / 20.0)
+            n = np.arange(ANALYSIS_SAMPLES)
+            x = (amp * np.sin(w * n)
+                 + NOISE_AMPLITUDE * rng.standard_normal(ANALYSIS_SAMPLES))
+            x = x.astype(np.float32)  # mic samples are f32 on target
+
+            ref = goertzel(x, coeff, np.longdouble, np.longdouble)
+            for name, (sd, fd) in {
+                "f32/f32": (np.float32, np.float32),
+                "f32/f64": (np.float32, np.float64),
+                "f64/f64": (np.float64, np.float64),
+            }.items():
+                err = abs(goertzel(x, coeff, sd, fd) - ref)
+                errs[name] = max(errs[name], err)
+                worst[name] = max(worst[name], err)
+
+        print(f"{BAND_FREQS[band]:>4} Hz {errs['f32/f32']:>10.4f} "
+              f"{errs['f32/f64']:>10.4f} {errs['f64/f64']:>12.6f}")
+
+    print()
+    print(f"{'worst':>6} {worst['f32/f32']:>10.4f} {worst['f32/f64']:>10.4f} "
+          f"{worst['f64/f64']:>12.6f}")
+    print()
+
+    if worst["f64/f64"] > F64_MAX_ERROR_DB:
+        print(f"FAIL: f64 detector error {worst['f64/f64']:.6f} dB "
+              f"exceeds {F64_MAX_ERROR_DB} dB")
+        all_pass = False
+    if worst["f32/f64"] * F32_FINALIZE_GAIN_REQUIRED > worst["f32/f32"]:
+        print("FAIL: f64 finalize does not materially improve on f32/f32")
+        all_pass = False
+
+    if all_pass:
+        print(f"PASS: f64 detector within {F64_MAX_ERROR_DB} dB; "
+              "f64 finalize alone removes most of the f32 bank error")
+    return 0 if all_pass else 1
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())